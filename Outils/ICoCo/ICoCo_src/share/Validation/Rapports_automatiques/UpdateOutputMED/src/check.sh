@@ -0,0 +1,6 @@
+#!/bin/bash
+# Le programme ecrit une ligne "update N OK|KO" par appel a updateOutputMEDDoubleField
+err=0
+[ `grep -c "^update [12] OK" test.out` -ne 2 ] && echo $ECHO_OPTS "Error: the MED field was not updated in place" && err=1
+grep "^update" test.out
+exit $err
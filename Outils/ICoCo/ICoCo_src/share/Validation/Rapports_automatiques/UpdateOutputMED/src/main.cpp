@@ -0,0 +1,130 @@
+#include <ICoCoProblem.h>
+#include <ICoCoMEDDoubleField.hxx>
+#include "CommInterface.hxx"
+#include "ProcessorGroup.hxx"
+#include "MPIProcessorGroup.hxx"
+#include <MEDCouplingFieldDouble.hxx>
+#include <set>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace MEDCoupling;
+using namespace std;
+using namespace ICoCo;
+
+// Avance le probleme de nb_pas pas de temps
+bool avancer(Problem* T, int nb_pas)
+{
+  for (int i=0; i<nb_pas; i++)
+    {
+      bool stop=false;
+      double dt=T->computeTimeStep(stop);
+      if (stop)
+        return false;
+      T->initTimeStep(dt);
+      if (!T->solveTimeStep())
+        return false;
+      T->validateTimeStep();
+    }
+  return true;
+}
+
+// Verifie que updateOutputMEDDoubleField a ecrit dans le tableau existant
+// (meme maillage, meme tableau) et que les valeurs ont change depuis la copie precedente
+bool verifier_mise_a_jour(const MEDDoubleField& field, const MEDCouplingMesh* maillage, const DataArrayDouble* tableau, vector<double>& valeurs)
+{
+  const MEDCouplingFieldDouble* f=field.getMCField();
+  if (!f || f->getMesh()!=maillage || f->getArray()!=tableau)
+    {
+      cout << "mesh or array reallocated by updateOutputMEDDoubleField" << endl;
+      return false;
+    }
+  const double* v=tableau->getConstPointer();
+  size_t n=tableau->getNbOfElems();
+  if (n!=valeurs.size())
+    return false;
+  double ecart_max=0.;
+  for (size_t i=0; i<n; i++)
+    {
+      double ecart=v[i]-valeurs[i];
+      if (ecart<0) ecart=-ecart;
+      if (ecart>ecart_max) ecart_max=ecart;
+      valeurs[i]=v[i];
+    }
+  cout << "max variation of the field since the last update: " << ecart_max << endl;
+  return ecart_max>0.;
+}
+
+int main(int argc,char **argv)
+{
+  MPI_Init(&argc,&argv);
+
+  bool ok=true;
+  {
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD,&size);
+    if (size!=1)
+      {
+        cout << "pb: must run on 1 processor !" << endl;
+        exit(1);
+      }
+
+    CommInterface comm;
+    set<int> dom_ids;
+    dom_ids.insert(0);
+    MPIProcessorGroup dom_group(comm,dom_ids);
+
+    std::string data_file="test";
+    if (!freopen("test.out","w",stdout)) abort();
+    if (!freopen("test.err","w",stderr)) abort();
+    const MPI_Comm* mpicomm=dom_group.getComm();
+
+    Problem* T=getProblem();
+    T->setDataFile(data_file);
+    T->setMPIComm((void*)mpicomm);
+    T->initialize();
+
+    // Champ de sortie de temperature aux elements declare dans le bloc Post_processing
+    std::string nom;
+    vector<string> outputnames=T->getOutputFieldsNames();
+    for (unsigned int ii=0; ii<outputnames.size(); ii++)
+      if (outputnames[ii].find("TEMPERATURE_ELEM")==0)
+        nom=outputnames[ii];
+    if (nom=="")
+      {
+        cout << "TEMPERATURE_ELEM output field not found" << endl;
+        ok=false;
+      }
+    else
+      {
+        MEDDoubleField field;
+        ok=avancer(T,2);
+        T->getOutputMEDDoubleField(nom,field);
+        const MEDCouplingMesh* maillage=field.getMCField()->getMesh();
+        const DataArrayDouble* tableau=field.getMCField()->getArray();
+        vector<double> valeurs(tableau->getConstPointer(),tableau->getConstPointer()+tableau->getNbOfElems());
+
+        // Deux mises a jour successives : les valeurs doivent evoluer dans le meme tableau
+        for (int update=1; update<=2 && ok; update++)
+          {
+            ok=avancer(T,5);
+            if (ok)
+              {
+                T->updateOutputMEDDoubleField(nom,field);
+                ok=verifier_mise_a_jour(field,maillage,tableau,valeurs);
+              }
+            cout << "update " << update << (ok?" OK":" KO") << endl;
+          }
+      }
+
+    T->terminate();
+    delete T;
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Finalize();
+  return ok?0:1;
+}
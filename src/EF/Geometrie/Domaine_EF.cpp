@@ -585,6 +585,7 @@ void Domaine_EF::calculer_Bij(DoubleTab& bij)
             }
           //exit();
         }
+      detecter_hexa_affines(bij);
     }
   if (0)
     {
@@ -620,6 +621,37 @@ void Domaine_EF::calculer_Bij(DoubleTab& bij)
   if (err) exit();
 
 }
+/*! @brief Repere si les Bij de tous les hexaedres (reels et virtuels) se deduisent des coordonnees de leurs sommets
+ *
+ *   (cf calculer_bij_hexa_affine). Dans ce cas, les operateurs peuvent recalculer Bij a la volee au lieu de relire
+ *   le tableau Bij_ (24 doubles par element) : c'est le cas des maillages cartesiens ou extrudes a mailles parallelepipediques.
+ *
+ */
+void Domaine_EF::detecter_hexa_affines(const DoubleTab& bij)
+{
+  const int nbelem = nb_elem_tot();
+  const IntTab& les_elems = domaine().les_elems();
+  const DoubleTab& coord = domaine().coord_sommets();
+  double bij_aff[8][3];
+  int nb_non_affines = 0;
+  for (int elem = 0; elem < nbelem; elem++)
+    {
+      calculer_bij_hexa_affine(&coord(les_elems(elem, 0), 0), &coord(les_elems(elem, 1), 0),
+                               &coord(les_elems(elem, 2), 0), &coord(les_elems(elem, 4), 0), bij_aff);
+      double max_bij = 0, ecart = 0;
+      for (int i = 0; i < 8; i++)
+        for (int d = 0; d < 3; d++)
+          {
+            max_bij = std::max(max_bij, std::fabs(bij(elem, i, d)));
+            ecart = std::max(ecart, std::fabs(bij(elem, i, d) - bij_aff[i][d]));
+          }
+      if (ecart > 1e-8 * max_bij)
+        nb_non_affines++;
+    }
+  hexa_affines_ = (mp_max(nb_non_affines) == 0);
+  Cerr << "Domaine_EF : " << (hexa_affines_ ? "affine hexahedra, Bij will be computed on the fly" : "non affine hexahedra, Bij are stored") << finl;
+}
+
 void Domaine_EF::calculer_porosites_sommets()
 {
 
@@ -115,6 +115,10 @@ public :
   {
     return Bij_thilde_ ;
   };
+  inline int hexa_affines() const
+  {
+    return hexa_affines_ ;
+  };
   inline const DoubleTab& IPhi() const
   {
     return IPhi_ ;
@@ -132,6 +136,7 @@ private:
   DoubleVect porosite_sommets_ ,volumes_sommets_thilde_,volumes_thilde_;
   //  Champ_Don champ_porosite_sommets_,champ_porosite_lu_;
   DoubleTab Bij_,Bij_thilde_;                         // stockage des matrice Bije
+  int hexa_affines_ = 0;                // vaut 1 si les Bij de tous les hexaedres se deduisent de leurs sommets (elements affines)
 
   double h_carre= 1.e30;			 // carre du pas du maillage
   DoubleVect h_carre_;			// carre du pas d'une maille
@@ -141,9 +146,45 @@ private:
   void remplir_elem_faces() override;
   Sortie& ecrit(Sortie& os) const;
   void creer_faces_virtuelles_non_std();
+  void detecter_hexa_affines(const DoubleTab& bij);
   IntVect orientation_;
 };
 
+/*! @brief Calcule les Bij (integrale du gradient des fonctions de base Q1) d'un hexaedre affine (parallelepipede)
+ *
+ *   a partir des sommets 0, 1, 2 et 4 (numerotation locale TRUST). Pour un element affine de jacobien J=[a b c],
+ *   Bij(i,.) = det(J) J^-T s_i / 4 ou s_i est le signe (+1/-1) du sommet i de l'element de reference, et les colonnes
+ *   de det(J) J^-T sont les produits vectoriels b^c, c^a et a^b : aucune inversion n'est necessaire.
+ *
+ */
+KOKKOS_INLINE_FUNCTION void calculer_bij_hexa_affine(const double *x0, const double *x1, const double *x2, const double *x4, double bij[8][3])
+{
+  double a[3], b[3], c[3], cof[3][3];
+  for (int d = 0; d < 3; d++)
+    {
+      a[d] = x1[d] - x0[d];
+      b[d] = x2[d] - x0[d];
+      c[d] = x4[d] - x0[d];
+    }
+  cof[0][0] = b[1] * c[2] - b[2] * c[1];
+  cof[0][1] = b[2] * c[0] - b[0] * c[2];
+  cof[0][2] = b[0] * c[1] - b[1] * c[0];
+  cof[1][0] = c[1] * a[2] - c[2] * a[1];
+  cof[1][1] = c[2] * a[0] - c[0] * a[2];
+  cof[1][2] = c[0] * a[1] - c[1] * a[0];
+  cof[2][0] = a[1] * b[2] - a[2] * b[1];
+  cof[2][1] = a[2] * b[0] - a[0] * b[2];
+  cof[2][2] = a[0] * b[1] - a[1] * b[0];
+  for (int i = 0; i < 8; i++)
+    for (int d = 0; d < 3; d++)
+      {
+        double val = 0;
+        for (int k = 0; k < 3; k++)
+          val += ((i >> k) & 1 ? cof[k][d] : -cof[k][d]);
+        bij[i][d] = 0.25 * val;
+      }
+}
+
 // Fonctions inline
 
 // Decription:
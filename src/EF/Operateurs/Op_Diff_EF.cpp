@@ -20,6 +20,7 @@
 #include <Milieu_base.h>
 #include <Debog.h>
 #include <TRUSTTrav.h>
+#include <Device.h>
 #include <Probleme_base.h>
 #include <Neumann_paroi.h>
 #include <Echange_global_impose.h>
@@ -136,7 +137,9 @@ DoubleTab& Op_Diff_EF::ajouter(const DoubleTab& tab_inconnue, DoubleTab& resu) c
   Nature_du_champ nat= equation().inconnue().valeur().nature_du_champ();
   if (nat==vectoriel)
     {
-      if ((dimension==3)&&(nb_som_elem==8))
+      if ((dimension==3)&&(nb_som_elem==8)&&domaine_ef.hexa_affines())
+        return ajouter_hexa_affines(tab_inconnue,resu);
+      else if ((dimension==3)&&(nb_som_elem==8))
         return ajouter_vectoriel_dim3_nbn_8(tab_inconnue,resu);
       else if ((dimension==2)&&(nb_som_elem==4))
         {
@@ -157,7 +160,9 @@ DoubleTab& Op_Diff_EF::ajouter(const DoubleTab& tab_inconnue, DoubleTab& resu) c
           exit();
           return ajouter(tab_inconnue,resu);
         }
-      if ((dimension==3)&&(nb_som_elem==8))
+      if ((dimension==3)&&(nb_som_elem==8)&&domaine_ef.hexa_affines())
+        return ajouter_hexa_affines(tab_inconnue,resu);
+      else if ((dimension==3)&&(nb_som_elem==8))
         return ajouter_scalaire_dim3_nbn_8(tab_inconnue,resu);
       else if ((dimension==2)&&(nb_som_elem==4))
         {
@@ -202,6 +207,88 @@ DoubleTab& Op_Diff_EF::ajouter_scalaire_gen(const DoubleTab& tab_inconnue, Doubl
   return ajouter_scalaire_template<AJOUTE_SCAL::GEN>(tab_inconnue,resu);
 }
 
+/*! @brief Version sans stockage de Bij pour les hexaedres affines (cf Domaine_EF::hexa_affines())
+ *
+ *   Les Bij de l'element sont recalcules a partir des coordonnees de 4 sommets au lieu d'etre relus dans
+ *   Domaine_EF::Bij() (12 doubles, partages entre elements voisins, contre 24 doubles par element).
+ *   Les contributions sont accumulees aux sommets par des atomic_add. Le champ est scalaire ou vectoriel (N=3).
+ *
+ */
+DoubleTab& Op_Diff_EF::ajouter_hexa_affines(const DoubleTab& tab_inconnue, DoubleTab& resu) const
+{
+  const Domaine_EF& domaine_ef = le_dom_EF.valeur();
+  const int N = resu.line_size();
+  const int nb_elem_tot = domaine_ef.domaine().nb_elem_tot();
+  assert(N == 1 || N == 3);
+
+  ArrOfInt marqueur_neuman;
+  if (N == 3)
+    remplir_marqueur_sommet_neumann(marqueur_neuman, domaine_ef, la_zcl_EF.valeur(), transpose_partout_);
+  else
+    marqueur_neuman.resize_array(1);
+  const int transpose_v = (N == 1) ? 0 : transpose_;
+  const int avec_marqueur_elem = marqueur_elem().size_array() > 0;
+  const ArrOfInt& marqueur_elem_tab = avec_marqueur_elem ? marqueur_elem() : marqueur_neuman;
+
+  CIntTabView elems_v = domaine_ef.domaine().les_elems().view_ro();
+  CDoubleTabView coord_v = domaine_ef.domaine().coord_sommets().view_ro();
+  CDoubleArrView volumes_v = domaine_ef.volumes().view_ro();
+  CDoubleArrView volumes_thilde_v = domaine_ef.volumes_thilde().view_ro();
+  CDoubleTabView nu_v = nu_.view_ro();
+  CIntArrView marqueur_neuman_v = marqueur_neuman.view_ro();
+  CIntArrView marqueur_elem_v = marqueur_elem_tab.view_ro();
+  CDoubleTabView inconnue_v = tab_inconnue.view_ro();
+  DoubleTabView resu_v = resu.view_rw();
+
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Element loop in Op_Diff_EF::ajouter_hexa_affines", nb_elem_tot, KOKKOS_LAMBDA(const int elem)
+  {
+    if (avec_marqueur_elem && marqueur_elem_v(elem) == 1) return;
+
+    int som[8];
+    double x[4][3], bij[8][3], u[8][3];
+    for (int i = 0; i < 8; i++)
+      som[i] = elems_v(elem, i);
+    for (int d = 0; d < 3; d++)
+      {
+        x[0][d] = coord_v(som[0], d);
+        x[1][d] = coord_v(som[1], d);
+        x[2][d] = coord_v(som[2], d);
+        x[3][d] = coord_v(som[4], d);
+      }
+    calculer_bij_hexa_affine(x[0], x[1], x[2], x[3], bij);
+    for (int i = 0; i < 8; i++)
+      for (int n = 0; n < N; n++)
+        u[i][n] = inconnue_v(som[i], n);
+
+    const double pond = volumes_thilde_v(elem) / volumes_v(elem) / volumes_v(elem) * nu_v(elem, 0);
+    for (int i1 = 0; i1 < 8; i1++)
+      {
+        const int transpose = (N == 1 || marqueur_neuman_v(som[i1]) == 1) ? 0 : transpose_v;
+        double pr[3] = { 0., 0., 0. };
+        for (int i2 = 0; i2 < 8; i2++)
+          {
+            double prod = 0, prod2 = 0;
+            for (int b = 0; b < 3; b++)
+              {
+                prod += bij[i1][b] * bij[i2][b];
+                if (transpose)
+                  prod2 += bij[i1][b] * u[i2][b];
+              }
+            for (int n = 0; n < N; n++)
+              pr[n] += prod * u[i2][n] + prod2 * bij[i2][n];
+          }
+        for (int n = 0; n < N; n++)
+          Kokkos::atomic_sub(&resu_v(som[i1], n), pr[n] * pond);
+      }
+  });
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Element loop in Op_Diff_EF::ajouter_hexa_affines");
+
+  // on ajoute la contribution des bords
+  ajouter_bords(tab_inconnue, resu);
+  return resu;
+}
+
 DoubleTab& Op_Diff_EF::ajouter_new(const DoubleTab& tab_inconnue, DoubleTab& resu) const
 {
   Cerr<<"NEW"<<finl;
@@ -79,6 +79,8 @@ protected :
 
   template<AJOUTE_VECT _T_>
   DoubleTab& ajouter_vectoriel_template(const DoubleTab&, DoubleTab&) const;
+
+  DoubleTab& ajouter_hexa_affines(const DoubleTab&, DoubleTab&) const;
 };
 
 class Op_Diff_option_EF : public Op_Diff_EF
@@ -35,6 +35,7 @@ public :
   void modifier_flux(const Operateur_base&) const;
   int impr(Sortie&, const Operateur_base&) const;
   int elem_contribue(const int elem) const;
+  inline const ArrOfInt& marqueur_elem() const { return marqueur_elem_; }
   void marque_elem( const Equation_base& eqn);
 protected:
   Matrice_Morse matrice_sto_;
@@ -253,17 +253,23 @@ void Source_PDF_EF::compute_indicateur_nodal_champ_aire()
   int nb_som_elem=domaine_EF.domaine().nb_som_elem();
   const IntTab& elems= domaine_EF.domaine().les_elems() ;
 
+  // liste persistante des elements solides (aire > 0) : les boucles de la source ne parcourent que ceux-ci
+  int nb_elems_solides = 0;
+  for (int num_elem=0; num_elem<nb_elems; num_elem++)
+    if (aire(num_elem)>0.) nb_elems_solides++;
+  elems_solides_.resize_array(nb_elems_solides);
+  for (int num_elem=0, k=0; num_elem<nb_elems; num_elem++)
+    if (aire(num_elem)>0.) elems_solides_[k++] = num_elem;
+
   DoubleTab indic(nb_nodes);
   indic = 0.;
-  for (int num_elem=0; num_elem<nb_elems; num_elem++)
+  for (int k=0; k<elems_solides_.size_array(); k++)
     {
-      if (aire(num_elem)>0.)
+      const int num_elem = elems_solides_[k];
+      for (int i=0; i<nb_som_elem; i++)
         {
-          for (int i=0; i<nb_som_elem; i++)
-            {
-              int s1=elems(num_elem,i);
-              indic(s1) = 1.;
-            }
+          int s1=elems(num_elem,i);
+          indic(s1) = 1.;
         }
     }
   indicateur_nodal_champ_aire_ = indic;
@@ -448,7 +454,6 @@ DoubleTab Source_PDF_EF::compute_coeff_matrice_pression() const
   const Domaine_EF& domaine_EF = le_dom_EF.valeur();
   const IntTab& elems= domaine_EF.domaine().les_elems();
   int nb_som_elem=domaine_EF.domaine().nb_som_elem();
-  int nb_elems=domaine_EF.domaine().nb_elem_tot();
   int nb_som_tot=domaine_EF.domaine().nb_som_tot();
   ArrOfDouble vitesse_elem(dimension);
   const DoubleTab& rotation=champ_rotation_.valeurs();
@@ -473,26 +478,21 @@ DoubleTab Source_PDF_EF::compute_coeff_matrice_pression() const
 
   double val_coeff ;
   DoubleVect val_diag_coef(dim_esp), coeff_el(dim_esp) ;
-  for (int num_elem=0; num_elem<nb_elems; num_elem++)
+  // les elements fluides (aire <= 0) ont un coefficient nul et ne contribuent pas
+  for (int k=0; k<elems_solides_.size_array(); k++)
     {
-      if (aire(num_elem)<=0.)
+      const int num_elem = elems_solides_[k];
+      vitesse_elem=0.;
+      for (int s=0; s<nb_som_elem; s++)
         {
-          for (int comp=0; comp<dim_esp; comp++) coeff_el(comp) = 0. ;
-        }
-      else
-        {
-          vitesse_elem=0.;
-          for (int s=0; s<nb_som_elem; s++)
-            {
-              int som_glob=elems(num_elem,s);
-              for (int comp=0; comp<dimension; comp++)
-                vitesse_elem[comp]+=vitesse(som_glob,comp);
-            }
-          val_coeff = fonct_coeff(rho_m(num_elem), aire(num_elem), dt) ;
-          val_diag_coef = diag_coeff_elem(vitesse_elem, rotation, num_elem) ;
-          for (int comp=0; comp<dim_esp; comp++)
-            coeff_el(comp) = val_coeff * val_diag_coef(comp) * dt / rho_m(num_elem) ;
+          int som_glob=elems(num_elem,s);
+          for (int comp=0; comp<dimension; comp++)
+            vitesse_elem[comp]+=vitesse(som_glob,comp);
         }
+      val_coeff = fonct_coeff(rho_m(num_elem), aire(num_elem), dt) ;
+      val_diag_coef = diag_coeff_elem(vitesse_elem, rotation, num_elem) ;
+      for (int comp=0; comp<dim_esp; comp++)
+        coeff_el(comp) = val_coeff * val_diag_coef(comp) * dt / rho_m(num_elem) ;
       for (int i = 0; i<nb_som_elem; i++)
         {
           int s = elems(num_elem,i);
@@ -540,9 +540,14 @@ void Source_PDF_EF::multiply_coeff_volume(DoubleTab& coeff) const
     }
 }
 
-DoubleTab Source_PDF_EF::compute_pond(const DoubleTab& rho_m, const DoubleTab& aire, const DoubleVect& volume_thilde, int& nb_som_elem, int& nb_elems) const
+const DoubleTab& Source_PDF_EF::compute_pond(const DoubleTab& rho_m, const DoubleTab& aire, const DoubleVect& volume_thilde, int& nb_som_elem, int& nb_elems) const
 {
-  DoubleTab pond = rho_m;
+  // pond_ est alloue une fois ; seules les valeurs des elements solides sont (re)calculees et lues
+  if (pond_.size_totale() != rho_m.size_totale())
+    {
+      pond_ = rho_m;
+      pond_ = 0.;
+    }
   double inv_nb_som = 1. / nb_som_elem;
 
   const double dt_ref = equation().probleme().schema_temps().pas_de_temps();
@@ -553,13 +558,14 @@ DoubleTab Source_PDF_EF::compute_pond(const DoubleTab& rho_m, const DoubleTab& a
       dt = 1.0;
     }
 
-  for (int num_elem=0; num_elem<nb_elems; num_elem++)
+  for (int k=0; k<elems_solides_.size_array(); k++)
     {
-      pond(num_elem) = fonct_coeff(rho_m(num_elem), aire(num_elem), dt) ;
-      pond(num_elem) *= volume_thilde(num_elem)*inv_nb_som*inv_nb_som;
+      const int num_elem = elems_solides_[k];
+      pond_(num_elem) = fonct_coeff(rho_m(num_elem), aire(num_elem), dt) ;
+      pond_(num_elem) *= volume_thilde(num_elem)*inv_nb_som*inv_nb_som;
     }
 
-  return pond;
+  return pond_;
 }
 
 /*##################################################################################################
@@ -610,65 +616,61 @@ DoubleTab& Source_PDF_EF::ajouter_(const DoubleTab& vitesse, DoubleTab& resu, co
   //Champ_Don rho_test;
   //champ_rho_.valeur().affecter(equation().probleme().get_champ("masse_volumique"));
   const DoubleTab& rho_m=champ_rho_.valeurs();
-  DoubleTab pond;
+  const DoubleTab& pond = compute_pond(rho_m, aire, volume_thilde, nb_som_elem, nb_elems);
 
-  pond = compute_pond(rho_m, aire, volume_thilde, nb_som_elem, nb_elems);
-
-  for (int num_elem=0; num_elem<nb_elems; num_elem++)
+  for (int k=0; k<elems_solides_.size_array(); k++)
     {
-      if (aire(num_elem)>0.)
+      const int num_elem = elems_solides_[k];
+      if (i_traitement_special == 0)
         {
-          if (i_traitement_special == 0)
-            {
-              tuvw[0] =  1.0 / modele_lu_.eta_;
-              tuvw[1] =  1.0 / modele_lu_.eta_;
-              tuvw[2] =  1.0 / modele_lu_.eta_;
-            }
-          else if (i_traitement_special == 1) //terme temps en rho v
-            {
-              tuvw[0] =  1.0;
-              tuvw[1] =  1.0;
-              tuvw[2] =  1.0;
-            }
-          else if (i_traitement_special == 101) //terme temps en v
-            {
-              tuvw[0] =  1.0 / rho_m(num_elem);
-              tuvw[1] =  1.0 / rho_m(num_elem);
-              tuvw[2] =  1.0 / rho_m(num_elem);
-            }
-          else if (i_traitement_special == 2)
-            {
-              tuvw[0] =  1.0 + 1.0 / modele_lu_.eta_;
-              tuvw[1] =  1.0 + 1.0 / modele_lu_.eta_;
-              tuvw[2] =  1.0 + 1.0 / modele_lu_.eta_;
-            }
-          else if (i_traitement_special == 102)
-            {
-              tuvw[0] =  1.0 / rho_m(num_elem) + 1.0 / modele_lu_.eta_;
-              tuvw[1] =  1.0 / rho_m(num_elem) + 1.0 / modele_lu_.eta_;
-              tuvw[2] =  1.0 / rho_m(num_elem) + 1.0 / modele_lu_.eta_;
-            }
-          else
-            {
-              Cerr << "Source_PDF_EF::ajouter_ : i_traitement_special should be 0, 1, 2, 101 or 102" << finl;
-              exit();
-            }
-          for (int comp=0; comp<ncomp; comp++)
+          tuvw[0] =  1.0 / modele_lu_.eta_;
+          tuvw[1] =  1.0 / modele_lu_.eta_;
+          tuvw[2] =  1.0 / modele_lu_.eta_;
+        }
+      else if (i_traitement_special == 1) //terme temps en rho v
+        {
+          tuvw[0] =  1.0;
+          tuvw[1] =  1.0;
+          tuvw[2] =  1.0;
+        }
+      else if (i_traitement_special == 101) //terme temps en v
+        {
+          tuvw[0] =  1.0 / rho_m(num_elem);
+          tuvw[1] =  1.0 / rho_m(num_elem);
+          tuvw[2] =  1.0 / rho_m(num_elem);
+        }
+      else if (i_traitement_special == 2)
+        {
+          tuvw[0] =  1.0 + 1.0 / modele_lu_.eta_;
+          tuvw[1] =  1.0 + 1.0 / modele_lu_.eta_;
+          tuvw[2] =  1.0 + 1.0 / modele_lu_.eta_;
+        }
+      else if (i_traitement_special == 102)
+        {
+          tuvw[0] =  1.0 / rho_m(num_elem) + 1.0 / modele_lu_.eta_;
+          tuvw[1] =  1.0 / rho_m(num_elem) + 1.0 / modele_lu_.eta_;
+          tuvw[2] =  1.0 / rho_m(num_elem) + 1.0 / modele_lu_.eta_;
+        }
+      else
+        {
+          Cerr << "Source_PDF_EF::ajouter_ : i_traitement_special should be 0, 1, 2, 101 or 102" << finl;
+          exit();
+        }
+      for (int comp=0; comp<ncomp; comp++)
+        {
+          double tijvj=0;
+          for (int c=0; c<ncomp; c++)
             {
-              double tijvj=0;
-              for (int c=0; c<ncomp; c++)
-                {
-                  double coeff_im=0;
-                  for(int k=0; k<ncomp; k++)
-                    {
-                      coeff_im+=rotation(num_elem,3*k+comp)*tuvw[k]*rotation(num_elem,3*k+c);
-                    }
-                  tijvj+=coeff_im ;
-                }
-              for (int i=0; i<nb_som_elem; i++)
+              double coeff_im=0;
+              for(int k=0; k<ncomp; k++)
                 {
-                  resu(elems(num_elem,i),comp)-=pond(num_elem)*nb_som_elem*tijvj*vitesse(elems(num_elem,i),comp);
+                  coeff_im+=rotation(num_elem,3*k+comp)*tuvw[k]*rotation(num_elem,3*k+c);
                 }
+              tijvj+=coeff_im ;
+            }
+          for (int i=0; i<nb_som_elem; i++)
+            {
+              resu(elems(num_elem,i),comp)-=pond(num_elem)*nb_som_elem*tijvj*vitesse(elems(num_elem,i),comp);
             }
         }
     }
@@ -706,37 +708,33 @@ void  Source_PDF_EF::contribuer_a_avec(const DoubleTab& inco, Matrice_Morse& mat
   const DoubleTab& aire=champ_aire_.valeurs();
   //champ_rho_.valeur().affecter(equation().probleme().get_champ("masse_volumique"));
   const DoubleTab& rho_m=champ_rho_.valeurs();
-  DoubleTab pond ;
-
-  pond = compute_pond(rho_m, aire, volume_thilde, nb_som_elem, nb_elems);
+  const DoubleTab& pond = compute_pond(rho_m, aire, volume_thilde, nb_som_elem, nb_elems);
 
-  for (int num_elem=0; num_elem<nb_elems; num_elem++) //elements loop
+  for (int k=0; k<elems_solides_.size_array(); k++) //elements loop
     {
-      if (aire(num_elem)>0.)
-        {
-          tuvw[0] = 1.0 / modele_lu_.eta_;
-          tuvw[1] = 1.0 / modele_lu_.eta_;
-          tuvw[2] = 1.0 / modele_lu_.eta_;
+      const int num_elem = elems_solides_[k];
+      tuvw[0] = 1.0 / modele_lu_.eta_;
+      tuvw[1] = 1.0 / modele_lu_.eta_;
+      tuvw[2] = 1.0 / modele_lu_.eta_;
 
-          for (int comp=0; comp<ncomp; comp++)
+      for (int comp=0; comp<ncomp; comp++)
+        {
+          for (int comp2=0; comp2<ncomp; comp2++)
             {
-              for (int comp2=0; comp2<ncomp; comp2++)
+              for (int i=0; i<nb_som_elem; i++)
                 {
-                  for (int i=0; i<nb_som_elem; i++)
+                  for (int j=0; j<nb_som_elem; j++)
                     {
-                      for (int j=0; j<nb_som_elem; j++)
-                        {
-                          int s1=elems(num_elem,i);
-
-                          double coeff_im=0;
-                          for (int k=0; k<3; k++)
-                            {
-                              coeff_im+=rotation(num_elem,3*k+comp)*tuvw[k]*rotation(num_elem,3*k+comp2);
-                            }
-                          int c1=s1*ncomp+comp;
+                      int s1=elems(num_elem,i);
 
-                          matrice.coef(c1,c1)+=pond(num_elem)*coeff_im;
+                      double coeff_im=0;
+                      for (int k=0; k<3; k++)
+                        {
+                          coeff_im+=rotation(num_elem,3*k+comp)*tuvw[k]*rotation(num_elem,3*k+comp2);
                         }
+                      int c1=s1*ncomp+comp;
+
+                      matrice.coef(c1,c1)+=pond(num_elem)*coeff_im;
                     }
                 }
             }
@@ -749,9 +747,7 @@ void  Source_PDF_EF::verif_ajouter_contrib(const DoubleTab& vitesse, Matrice_Mor
 {
   const Domaine_EF& domaine_EF = le_dom_EF.valeur();
   const IntTab& elems= domaine_EF.domaine().les_elems() ;
-  int nb_elems=domaine_EF.domaine().nb_elem_tot();
   int nb_som_elem=domaine_EF.domaine().nb_som_elem();
-  const DoubleTab& aire=champ_aire_.valeurs();
 
   DoubleTrav force(vitesse);
   ajouter_(vitesse,force);
@@ -760,21 +756,19 @@ void  Source_PDF_EF::verif_ajouter_contrib(const DoubleTab& vitesse, Matrice_Mor
   DoubleTab diforce(force);
   diforce += force2 ;
   double difmax = 0.;
-  for (int num_elem=0; num_elem<nb_elems; num_elem++)
+  for (int k=0; k<elems_solides_.size_array(); k++)
     {
-      if (aire(num_elem)>0.)
+      const int num_elem = elems_solides_[k];
+      for (int i=0; i<nb_som_elem; i++)
         {
-          for (int i=0; i<nb_som_elem; i++)
+          int s1=elems(num_elem,i);
+          double difmod2 = diforce(s1,0)*diforce(s1,0) + diforce(s1,1)*diforce(s1,1) + diforce(s1,2)*diforce(s1,2);
+          if (difmod2 > 1.0e-5)
             {
-              int s1=elems(num_elem,i);
-              double difmod2 = diforce(s1,0)*diforce(s1,0) + diforce(s1,1)*diforce(s1,1) + diforce(s1,2)*diforce(s1,2);
-              if (difmod2 > 1.0e-5)
-                {
-                  if (difmod2 > difmax) difmax = difmod2 ;
-                  // Cerr << " ajouter multvect diforce x = "<< force(s1,0) << " "<< force2(s1,0) << " " << diforce(s1,0)<<endl;
-                  // Cerr << " ajouter multvect diforce y = "<< force(s1,1) << " "<< force2(s1,1) << " " << diforce(s1,1)<<endl;
-                  // Cerr << " ajouter multvect diforce z = "<< force(s1,2) << " "<< force2(s1,2) << " " << diforce(s1,2)<<endl;
-                }
+              if (difmod2 > difmax) difmax = difmod2 ;
+              // Cerr << " ajouter multvect diforce x = "<< force(s1,0) << " "<< force2(s1,0) << " " << diforce(s1,0)<<endl;
+              // Cerr << " ajouter multvect diforce y = "<< force(s1,1) << " "<< force2(s1,1) << " " << diforce(s1,1)<<endl;
+              // Cerr << " ajouter multvect diforce z = "<< force(s1,2) << " "<< force2(s1,2) << " " << diforce(s1,2)<<endl;
             }
         }
     }
@@ -71,12 +71,14 @@ protected:
   void calculer_vitesse_imposee_power_law_tbl() override;
   void calculer_vitesse_imposee_power_law_tbl_u_star() override;
   void rotate_imposed_velocity(DoubleTab&) override;
-  DoubleTab compute_pond(const DoubleTab&, const DoubleTab&, const DoubleVect&, int&, int&) const ;
+  const DoubleTab& compute_pond(const DoubleTab&, const DoubleTab&, const DoubleVect&, int&, int&) const ;
   REF(Domaine_EF) le_dom_EF;
   REF(Domaine_Cl_EF) le_dom_Cl_EF;
   void associer_domaines(const Domaine_dis& ,const Domaine_Cl_dis& ) override;
   void compute_indicateur_nodal_champ_aire() override;
 
+  ArrOfInt elems_solides_;                   //!< elements ou aire > 0, remplis par compute_indicateur_nodal_champ_aire
+  mutable DoubleTab pond_;                   //!< ponderation par element, calculee en place par compute_pond
   DoubleVect tab_u_star_ibm_;                //!< valeurs des u* IBM calculees localement
   DoubleVect tab_y_plus_ibm_;                //!< valeurs des d+ IBM calculees localement
   mutable Champ_Fonc champ_u_star_ibm_;          //!< Champ pour postraitement
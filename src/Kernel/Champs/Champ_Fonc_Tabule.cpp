@@ -129,6 +129,7 @@ Entree& Champ_Fonc_Tabule::readOn(Entree& is)
       for (int i = 0; i < size; i++)
         is >> tab_valeurs[i];
       la_table.remplir(params, tab_valeurs);
+      la_table.partager_memoire_noeud();
 
       is >> motlu;
       if (motlu != accolade_fermee)
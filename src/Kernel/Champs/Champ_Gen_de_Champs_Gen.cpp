@@ -341,6 +341,21 @@ void Champ_Gen_de_Champs_Gen::get_copy_connectivity(Entity index1, Entity index2
   get_source(0).get_copy_connectivity(index1,index2,tab);
 }
 
+Nom Champ_Gen_de_Champs_Gen::signature_operateur(const char* type) const
+{
+  Nom sig(type);
+  for (int i = 0; i < get_nb_sources(); i++)
+    {
+      const Nom sig_source = get_source(i).signature();
+      if (sig_source == "")
+        return Nom();
+      sig += "|(";
+      sig += sig_source;
+      sig += ")";
+    }
+  return sig;
+}
+
 double Champ_Gen_de_Champs_Gen::get_time() const
 {
   return get_source(0).get_time();
@@ -101,6 +101,8 @@ public:
 
 
 protected:
+  // Signature d'un noeud operateur : type de l'operateur puis signatures de ses sources (vide si une source n'en a pas)
+  Nom signature_operateur(const char* type) const;
 
   LIST(Nom) noms_sources_ref_;
   LIST(REF(Champ_Generique_base)) sources_reference_; //permet de creer une source en faisant une reference a un
@@ -101,7 +101,7 @@ const Champ_base& Champ_Generique_Correlation::get_champ(Champ& espace_stockage)
   espace_stockage = creer_espace_stockage(nature_source,nb_comp,es_tmp);
 
   DoubleTab& tab_correlation = espace_stockage.valeurs();
-  tab_correlation = Op_Correlation_.calculer_valeurs();
+  Op_Correlation_.calculer_valeurs(tab_correlation);
   tab_correlation.echange_espace_virtuel();
   return espace_stockage.valeur();
 }
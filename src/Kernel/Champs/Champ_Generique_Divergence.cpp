@@ -73,11 +73,19 @@ const Champ_base& Champ_Generique_Divergence::get_champ_without_evaluation(Champ
     }
   return espace_stockage.valeur();
 }
+/*! @brief Signature du divergence : type de l'operateur et signature de la source.
+ *
+ */
+Nom Champ_Generique_Divergence::signature() const
+{
+  return signature_operateur("Divergence");
+}
+
 const Champ_base& Champ_Generique_Divergence::get_champ(Champ& espace_stockage) const
 {
 
   Champ source_espace_stockage;
-  const Champ_base& source = get_source(0).get_champ(source_espace_stockage);
+  const Champ_base& source = get_source(0).get_champ_memorise(source_espace_stockage);
 
   if (Op_Div_.non_nul())
     {
@@ -77,14 +77,14 @@ const Champ_base& Champ_Generique_Ecart_Type::get_champ(Champ& espace_stockage)
 {
   const REF(Champ_Generique_base)& mon_champ = integrale().le_champ();
   Champ espace_stockage_source;
-  const Champ_base& source = mon_champ->get_champ(espace_stockage_source);
+  const Champ_base& source = mon_champ->get_champ_memorise(espace_stockage_source);
   Nature_du_champ nature_source = source.nature_du_champ();
   int nb_comp = source.nb_comp();
   Champ_Fonc es_tmp;
   espace_stockage = creer_espace_stockage(nature_source,nb_comp,es_tmp);
 
   DoubleTab& tab_ecart_type = espace_stockage.valeurs();
-  tab_ecart_type = Op_Ecart_Type_.calculer_valeurs();
+  Op_Ecart_Type_.calculer_valeurs(tab_ecart_type);
   tab_ecart_type.echange_espace_virtuel();
   return espace_stockage.valeur();
 }
@@ -105,7 +105,7 @@ const Champ_base& Champ_Generique_Extraction::get_champ(Champ& espace_stockage)
 
   Champ source_espace_stockage;
   const Champ_Generique_base& source = get_source(0);
-  const Champ_base& source_stockage = source.get_champ(source_espace_stockage);
+  const Champ_base& source_stockage = source.get_champ_memorise(source_espace_stockage);
 
   const DoubleTab& source_valeurs = source_stockage.valeurs();
   const Domaine_dis_base& domaine_dis_source = source.get_ref_domaine_dis_base();
@@ -270,7 +270,7 @@ void Champ_Generique_Extraction::completer(const Postraitement_base& post)
       if (sub_type(Champ_Generique_refChamp,source))
         {
           Champ source_espace_stockage;
-          const Champ_base& source_stockage = source.get_champ(source_espace_stockage);
+          const Champ_base& source_stockage = source.get_champ_memorise(source_espace_stockage);
           if (!sub_type(Champ_Inc_base,source_stockage))
             {
               Cerr<<"The method "<<methode_<<" can be applied to extract only unknown fields of the problem."<<finl;
@@ -48,6 +48,7 @@ public:
   const   Motcle             get_directive_pour_discr() const override;
   const Champ_base&  get_champ(Champ& espace_stockage) const override;
   const Champ_base&  get_champ_without_evaluation(Champ& espace_stockage) const override;
+  Nom                signature() const override;
 
   inline const Operateur_base& Operateur() const override;
   inline Operateur_base& Operateur() override;
@@ -194,6 +194,31 @@ const Champ_base& Champ_Generique_Interpolation::get_champ(Champ& espace_stockag
   return espace_stockage.valeur();
 }
 
+/*! @brief Signature de l'interpolation : localisation, methode, domaine cible, composante et signature de la source.
+ *
+ * Vide tant que la source n'a pas de signature ou que la detection du sous-maillage n'a pas ete faite,
+ *   car ce premier appel doit etre execute par chaque champ.
+ */
+Nom Champ_Generique_Interpolation::signature() const
+{
+  if (optimisation_sous_maillage_==-1)
+    return Nom();
+  const Nom sig_source = get_source(0).signature();
+  if (sig_source=="")
+    return Nom();
+  Nom sig("Interpolation|");
+  sig += localisation_;
+  sig += "|";
+  sig += methode_;
+  sig += "|";
+  sig += get_ref_domain().le_nom();
+  sig += "|";
+  sig += identifiant_appel_;
+  sig += "|";
+  sig += sig_source;
+  return sig;
+}
+
 const Champ_base& Champ_Generique_Interpolation::get_champ_without_evaluation(Champ& espace_stockage) const
 {
 
@@ -232,7 +257,7 @@ const Champ_base& Champ_Generique_Interpolation::get_champ_without_evaluation(Ch
 const Champ_base& Champ_Generique_Interpolation::get_champ_with_calculer_champ_post(Champ& espace_stockage) const
 {
   Champ espace_stockage_source;
-  const Champ_base& source0 = get_source(0).get_champ(espace_stockage_source);
+  const Champ_base& source0 = get_source(0).get_champ_memorise(espace_stockage_source);
   Champ source_bis;
 
   if (optimisation_sous_maillage_==-1)
@@ -49,6 +49,7 @@ public:
   virtual int     set_domaine(const Nom& nom_domaine, int exit_on_error = 1);
   const Champ_base&  get_champ(Champ& espace_stockage) const override;
   const Champ_base&  get_champ_without_evaluation(Champ& espace_stockage) const override;
+  Nom                signature() const override;
   virtual const Champ_base&  get_champ_with_calculer_champ_post(Champ& espace_stockage) const;
 
   const DoubleTab&  get_ref_values() const override;
@@ -72,14 +72,14 @@ const Champ_base& Champ_Generique_Moyenne::get_champ(Champ& espace_stockage) con
 {
   const REF(Champ_Generique_base)& mon_champ = integrale().le_champ();
   Champ espace_stockage_source;
-  const Champ_base& source = mon_champ->get_champ(espace_stockage_source);
+  const Champ_base& source = mon_champ->get_champ_memorise(espace_stockage_source);
   Nature_du_champ nature_source = source.nature_du_champ();
   int nb_comp = source.nb_comp();
   Champ_Fonc es_tmp;
   espace_stockage = creer_espace_stockage(nature_source,nb_comp,es_tmp);
 
   DoubleTab& tab_moy = espace_stockage.valeurs();
-  tab_moy = Op_Moyenne_.calculer_valeurs();
+  Op_Moyenne_.calculer_valeurs(tab_moy);
   tab_moy.echange_espace_virtuel();
   return espace_stockage.valeur();
 }
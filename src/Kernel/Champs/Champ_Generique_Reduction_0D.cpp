@@ -199,7 +199,7 @@ const Champ_base& Champ_Generique_Reduction_0D::get_champ(Champ& espace_stockage
 {
 
   Champ source_espace_stockage;
-  const Champ_base& source = get_source(0).get_champ(source_espace_stockage);
+  const Champ_base& source = get_source(0).get_champ_memorise(source_espace_stockage);
   const Domaine_dis_base& domaine_dis = get_source(0).get_ref_domaine_dis_base();
   Nature_du_champ nature_source = source.nature_du_champ();
   int nb_comp = source.nb_comp();
@@ -627,7 +627,7 @@ void Champ_Generique_Reduction_0D::extraire(double& val_extraite,const DoubleVec
       if (get_localisation()==Entity::ELEMENT)
         {
           Champ source_espace_stockage2;
-          const Champ_base& source2 = get_source(1).get_champ(source_espace_stockage2);
+          const Champ_base& source2 = get_source(1).get_champ_memorise(source_espace_stockage2);
           Motcle nom_source_1(get_source(1).get_nom_post());
           if (!(nom_source_1.debute_par("porosite_volumique")||(nom_source_1.debute_par("beta"))))
             {
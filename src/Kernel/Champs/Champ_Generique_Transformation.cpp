@@ -577,7 +577,7 @@ const Champ_base& Champ_Generique_Transformation::get_champ(Champ& espace_stocka
     {
       const Champ_Generique_base& source = get_source(so);
       Champ stockage_so;
-      const Champ_base& source_so = source.get_champ(stockage_so);
+      const Champ_base& source_so = source.get_champ_memorise(stockage_so);
       const DoubleTab& source_so_val = source_so.valeurs();
       const Motcle directive_so = source.get_directive_pour_discr();
 
@@ -899,7 +899,7 @@ int Champ_Generique_Transformation::preparer_macro()
       for (int i=0; i<nb_sources; i++)
         {
           Champ source_espace_stockage;
-          const Champ_base& source = get_source(i).get_champ(source_espace_stockage);
+          const Champ_base& source = get_source(i).get_champ_memorise(source_espace_stockage);
           int nb_comp = source.nb_comp();
           if (source.nature_du_champ()!=vectoriel && source.nature_du_champ()!=multi_scalaire)
             {
@@ -932,7 +932,7 @@ int Champ_Generique_Transformation::preparer_macro()
           for (int i=0; i<nb_sources; i++)
             {
               Champ source_espace_stockage;
-              const Champ_base& source = get_source(i).get_champ(source_espace_stockage);
+              const Champ_base& source = get_source(i).get_champ_memorise(source_espace_stockage);
               int nb_comp = source.nb_comp();
               const Noms compo = get_source(i).get_property("composantes");
               for (int comp=0; comp<nb_comp; comp++)
@@ -425,6 +425,20 @@ const Champ_base& Champ_Generique_refChamp::get_champ_without_evaluation(Champ&
   return get_champ(espace_stockage);
 }
 
+/*! @brief Signature d'un champ de reference : probleme et nom du champ encapsule.
+ *
+ */
+Nom Champ_Generique_refChamp::signature() const
+{
+  if (!ref_champ_.non_nul() || !ref_pb_.non_nul())
+    return Nom();
+  Nom sig("refChamp|");
+  sig += ref_pb_->le_nom();
+  sig += "|";
+  sig += get_ref_champ_base().le_nom();
+  return sig;
+}
+
 /*! @brief Associe le champ et determine sa localisation.
  *
  */
@@ -66,6 +66,7 @@ public:
   //et renvoie la reference
   const Champ_base& get_champ(Champ& espace_stockage) const override;
   const Champ_base& get_champ_without_evaluation(Champ& espace_stockage) const override;
+  Nom signature() const override;
 
   virtual void set_ref_champ(const Champ_base&);
 
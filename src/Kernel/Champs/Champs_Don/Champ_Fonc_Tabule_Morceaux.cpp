@@ -106,6 +106,10 @@ Entree& Champ_Fonc_Tabule_Morceaux::readOn(Entree& is)
   if (mp_min_vect(i_mor) == -1)
     Process::exit(que_suis_je() + " : some pieces of the field are missing!");
 
+  // une fois le vecteur des morceaux fige (plus de recopie), les grandes tables sont portees par une copie par noeud
+  for (auto& morceau : morceaux)
+    morceau.la_table.partager_memoire_noeud();
+
   return is;
 }
 
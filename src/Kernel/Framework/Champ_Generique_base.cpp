@@ -17,8 +17,11 @@
 #include <Champs_compris.h>
 #include <Probleme_base.h>
 #include <Interprete.h>
+#include <TClearable.h>
 #include <TRUST_Ref.h>
 #include <Param.h>
+#include <string>
+#include <map>
 
 Implemente_base(Champ_Generique_base,"Champ_Generique_base",Objet_U);
 
@@ -63,6 +66,118 @@ double Champ_Generique_base::get_time() const
   throw Champ_Generique_erreur("NOT_IMPLEMENTED");
 }
 
+// Niveau d'imbrication du cache d'evaluation et numero de la passe de postraitement courante
+static int niveau_cache_evaluation = 0;
+static int passe_cache_evaluation = 0;
+
+/*! @brief Registre des evaluations partagees par tous les blocs de postraitement.
+ *
+ *  Cle : signature du sous-arbre (source, chaine d'operateurs, localisation) et identifiant_appel_. Chaque entree garde
+ *  la passe et le temps de sa derniere evaluation ; elle n'est supprimee qu'en fin de calcul (clear()), si bien que les
+ *  references rendues par get_champ_memorise() restent valides tant que la passe n'est pas terminee.
+ */
+class Registre_evaluations : public TClearable
+{
+public:
+  struct Evaluation
+  {
+    Champ stockage;
+    const Champ_base *resultat = nullptr;
+    int passe = -1;
+    double temps = 0.;
+    int nb_calculs = 0;       // nombre d'evaluations effectives
+    int nb_reutilisations = 0; // nombre d'appels servis sans evaluation
+  };
+
+  static Registre_evaluations& instance()
+  {
+    static Registre_evaluations registre;
+    static bool enregistre = false;
+    if (!enregistre)
+      {
+        TClearable::Register_clearable(&registre);
+        enregistre = true;
+      }
+    return registre;
+  }
+
+  Evaluation& operator[](const std::string& cle) { return evaluations_[cle]; }
+
+  // En fin de calcul : bilan des sous-arbres partages puis liberation des espaces de stockage (avant Kokkos::finalize)
+  void clear() override
+  {
+    if (Process::je_suis_maitre())
+      for (const auto& cle_ev : evaluations_)
+        if (cle_ev.second.nb_reutilisations > 0)
+          Cerr << "Shared post-processing field " << cle_ev.first << " : " << cle_ev.second.nb_calculs << " evaluation(s), "
+               << cle_ev.second.nb_reutilisations << " reuse(s)" << finl;
+    evaluations_.clear();
+  }
+
+private:
+  std::map<std::string, Evaluation> evaluations_;
+};
+
+/*! @brief Active le cache d'evaluation des champs generiques (appels imbriques autorises).
+ *
+ *  A encadrer autour d'une passe de postraitement : le temps ne change pas tant que le cache est actif.
+ *  Chaque activation du premier niveau ouvre une nouvelle passe, ce qui invalide les evaluations memorisees.
+ */
+void Champ_Generique_base::activer_cache_evaluation()
+{
+  if (niveau_cache_evaluation++ == 0)
+    passe_cache_evaluation++;
+}
+
+void Champ_Generique_base::desactiver_cache_evaluation()
+{
+  assert(niveau_cache_evaluation > 0);
+  niveau_cache_evaluation--;
+}
+
+Nom Champ_Generique_base::signature() const
+{
+  return Nom();
+}
+
+/*! @brief Evalue le champ en passant par le cache d'evaluation s'il est actif (sinon equivalent a get_champ()).
+ *
+ *  Un noeud ayant une signature() passe par le registre commun a tous les blocs de postraitement : les sous-arbres
+ *  identiques de blocs differents ne sont evalues qu'une fois par passe et par temps, et partagent leur espace de stockage.
+ *  Sinon le resultat est conserve dans le noeud avec le numero de la passe et identifiant_appel_ (nom ou composante demandee).
+ *  Methode parallele : la cle ne depend que du jeu de donnees, donc les evaluations restent synchrones.
+ */
+const Champ_base& Champ_Generique_base::get_champ_memorise(Champ& espace_stockage) const
+{
+  if (!niveau_cache_evaluation)
+    return get_champ(espace_stockage);
+
+  const Nom sig = signature();
+  if (sig != "")
+    {
+      Registre_evaluations::Evaluation& ev = Registre_evaluations::instance()[std::string(sig) + "|" + std::string(identifiant_appel_)];
+      const double temps = get_time();
+      if (!ev.resultat || ev.passe != passe_cache_evaluation || ev.temps != temps)
+        {
+          ev.resultat = &get_champ(ev.stockage);
+          ev.passe = passe_cache_evaluation;
+          ev.temps = temps;
+          ev.nb_calculs++;
+        }
+      else
+        ev.nb_reutilisations++;
+      return *ev.resultat;
+    }
+
+  if (!resultat_memorise_ || passe_memorisee_ != passe_cache_evaluation || identifiant_memorise_ != identifiant_appel_)
+    {
+      resultat_memorise_ = &get_champ(stockage_memorise_);
+      passe_memorisee_ = passe_cache_evaluation;
+      identifiant_memorise_ = identifiant_appel_;
+    }
+  return *resultat_memorise_;
+}
+
 /*! @brief Renvoie le probleme qui porte le champ cible
  *
  */
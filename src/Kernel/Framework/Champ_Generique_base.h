@@ -104,6 +104,17 @@ public:
   //return espace_stockage.valeur()
 
   virtual const Champ_base&   get_champ(Champ& espace_stockage) const = 0;
+
+  // Evaluation memorisee : tant que le cache d'evaluation est actif (une passe de postraitement, donc un seul temps),
+  // un noeud evalue plusieurs fois, ou plusieurs noeuds de meme signature() (blocs de postraitement differents), ne sont
+  // calcules qu'une fois. Le resultat est alors stocke dans le noeud ou dans le registre commun, et non dans espace_stockage :
+  // il n'est valide que jusqu'a la passe suivante.
+  const Champ_base&   get_champ_memorise(Champ& espace_stockage) const;
+  // Identifie le calcul realise par le noeud (type, options, sources) : deux noeuds de meme signature
+  // designent la meme valeur. Chaine vide : noeud non identifiable.
+  virtual Nom signature() const;
+  static void activer_cache_evaluation();
+  static void desactiver_cache_evaluation();
   virtual const Champ_base&   get_champ_without_evaluation(Champ& espace_stockage) const=0;
   /*
     {
@@ -132,6 +143,12 @@ protected:
   Nom identifiant_appel_;
   Nom nom_pb_;
   REF(Probleme_base) ref_pb_;
+
+private:
+  mutable Champ stockage_memorise_;                       // espace de stockage de la derniere evaluation memorisee
+  mutable const Champ_base *resultat_memorise_ = nullptr; // resultat de cette evaluation
+  mutable int passe_memorisee_ = -1;                      // passe de postraitement de cette evaluation
+  mutable Nom identifiant_memorise_;                      // identifiant_appel_ lors de cette evaluation
 };
 
 inline void Champ_Generique_base::fixer_identifiant_appel(const Nom& identifiant)
@@ -22,6 +22,7 @@
 #include <Domaine_VF.h>
 #include <Domaine.h>
 #include <Param.h>
+#include <climits>
 
 REF(Debog_Pb) Debog_Pb::instance_debog_;
 
@@ -387,7 +388,13 @@ void Debog_Pb::verifier_matrice(const char *const msg, const Matrice_Base& matri
   Nom id;
 
   // Boucle sur les items sequentiels du vecteur x de A*x=b
-  const int nb_colonnes = md_colonnes.valeur().nb_items_seq_tot();
+  const trustIdType nb_colonnes_seq = md_colonnes.valeur().nb_items_seq_tot();
+  if (nb_colonnes_seq > INT_MAX)
+    {
+      Cerr << "Error in Debog_Pb::verifier_matrice : " << nb_colonnes_seq << " columns, the matrix is too large to be written column by column." << finl;
+      Process::exit();
+    }
+  const int nb_colonnes = (int)nb_colonnes_seq;
 
   for (int i = 0; i < nb_colonnes; i++)
     {
@@ -49,7 +49,7 @@ void Debog_Pb::verifier_gen(const char *const msg, const TRUSTVect<_TYPE_>& arr,
   debog_data_file_ >> reference;
 
   const int n = reference.size_array();
-  const int nb_items_seq = arr.get_md_vector().valeur().nb_items_seq_tot();
+  const trustIdType nb_items_seq = arr.get_md_vector().valeur().nb_items_seq_tot();
   const int ls = arr.line_size();
 
   if (n != nb_items_seq * ls)
@@ -81,14 +81,21 @@ void Debog_Pb::verifier_partie(const TRUSTVect<_TYPE_>& reference, const TRUSTVe
           // (le tableau de reference contient toutes les valeurs sequentielles, sous-partie par sous-partie, la taille de la sous-partie est egale au nombre total
           // d'items sequentiels multiplie par le linesize de la sous-partie). Attention, toutes les sous-parties n'ont pas forcement la meme linesize
           const TRUSTTab<_TYPE_>& part = parts[i];
-          const int sequential_size = part.get_md_vector().valeur().nb_items_seq_tot();
+          const trustIdType sequential_size = part.get_md_vector().valeur().nb_items_seq_tot();
           const int line_size = part.line_size();
+          if (index + sequential_size * line_size > reference.size_array())
+            {
+              Cerr << "Error in Debog_Pb::verifier_partie : sequential size " << sequential_size * line_size << " of part " << i
+                   << " exceeds the reference array size " << reference.size_array() << finl;
+              Process::exit();
+            }
+          const int part_size = (int)(sequential_size * line_size); // <= reference.size_array() d'apres le test ci-dessus
           // ref_array() veut un tableau non const, mais on va l'utiliser uniquement en const...
           TRUSTArray<_TYPE_>& cast_array = ref_cast_non_const(TRUSTArray<_TYPE_>, reference);
-          ref_part.ref_array(cast_array, index, sequential_size * line_size);
+          ref_part.ref_array(cast_array, index, part_size);
           // Appel recursif pour la sous-partie:
           verifier_partie(ref_part, part, arr_ref);
-          index += sequential_size * line_size;
+          index += part_size;
         }
     }
 }
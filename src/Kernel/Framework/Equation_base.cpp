@@ -28,6 +28,7 @@
 #include <Operateur_base.h>
 #include <TRUSTTab_parts.h>
 #include <EcrFicPartage.h>
+#include <Reductions_Differees.h>
 #include <Postraitement.h>
 #include <Equation_base.h>
 #include <Statistiques.h>
@@ -259,6 +260,7 @@ void Equation_base::set_param(Param& param)
   param.ajouter_non_std("ecrire_fichier_xyz_valeur",(this)); // XD attr ecrire_fichier_xyz_valeur ecrire_fichier_xyz_valeur ecrire_fichier_xyz_valeur 1 This keyword is used to write the values of a field only for some boundaries in a text file
   param.ajouter("parametre_equation",&parametre_equation_); // XD attr parametre_equation parametre_equation_base parametre_equation 1 Keyword used to specify additional parameters for the equation
   param.ajouter_non_std("equation_non_resolue",(this)); // XD attr equation_non_resolue chaine equation_non_resolue 1 The equation will not be solved while condition(t) is verified if equation_non_resolue keyword is used. Exemple: The Navier-Stokes equations are not solved between time t0 and t1. NL2 Navier_Sokes_Standard NL2 { equation_non_resolue (t>t0)*(t<t1) }
+  param.ajouter_flag("fusion_operateurs|fused_operators",&fusion_operateurs_); // XD attr fusion_operateurs|fused_operators rien fusion_operateurs 1 For explicit time schemes, the diffusion and convection operators are applied in a single chunked sweep over the mesh when the discretization supports it (VDF face operators). Results may differ at round-off level.
 }
 
 int Equation_base::lire_motcle_non_standard(const Motcle& mot, Entree& is)
@@ -517,7 +519,15 @@ DoubleTab& Equation_base::derivee_en_temps_inco(DoubleTab& derivee)
   else
     {
       // Add all explicit operators
-      for(int i=0; i<nombre_d_operateurs(); i++)
+      int i_deb = 0;
+      if (fusion_operateurs_ && nombre_d_operateurs() > 1 && !has_time_factor_)
+        {
+          // Diffusion et convection en un seul balayage si les deux operateurs le permettent
+          const Operateur_base& op_diff = operateur(0).l_op_base(), &op_conv = operateur(1).l_op_base();
+          if (op_diff.get_decal_temps() != 1 && op_conv.get_decal_temps() != 1 && op_diff.get_nb_ss_pas_de_temps() == 1 && op_conv.get_nb_ss_pas_de_temps() == 1)
+            i_deb = op_diff.ajouter_fusionne(op_conv, inconnue().valeurs(), secmem) ? 2 : 0;
+        }
+      for(int i=i_deb; i<nombre_d_operateurs(); i++)
         if(operateur(i).l_op_base().get_decal_temps()!=1)
           {
             if (has_time_factor_)
@@ -1125,6 +1135,33 @@ void Equation_base::get_noms_champs_postraitables(Noms& noms,Option opt) const
  * @return (double) inverse de la somme des inverses des pas de temps calcules par les operateurs
  */
 double Equation_base::calculer_pas_de_temps() const
+{
+  Reductions_Differees dt_operateurs;
+  const int premier = ajouter_pas_de_temps_locaux(dt_operateurs);
+  dt_operateurs.reduire();
+  return combiner_pas_de_temps(dt_operateurs, premier);
+}
+
+/*! @brief Enregistre dans red le pas de temps de stabilite local (COLL_MIN) de chaque operateur.
+ *
+ * Permet a Probleme_base::calculer_pas_de_temps de reduire les pas de temps de tous les operateurs
+ *     de toutes les equations en une seule operation collective.
+ *
+ * @return (int) indice dans red du pas de temps du premier operateur, a passer a combiner_pas_de_temps()
+ */
+int Equation_base::ajouter_pas_de_temps_locaux(Reductions_Differees& red) const
+{
+  const int premier = red.size();
+  for (int i=0; i<nombre_d_operateurs(); i++)
+    red.ajouter(operateur(i).l_op_base().get_decal_temps()!=1 ? operateur(i).calculer_pas_de_temps_local() : DMAXFLOAT, Comm_Group::COLL_MIN);
+  return premier;
+}
+
+/*! @brief Combine les pas de temps des operateurs reduits par red (cf ajouter_pas_de_temps_locaux()).
+ *
+ * @return (double) inverse de la somme des inverses des pas de temps calcules par les operateurs
+ */
+double Equation_base::combiner_pas_de_temps(const Reductions_Differees& red, int premier) const
 {
   bool harmonic_calculation = true;
   double dt_op;
@@ -1137,10 +1174,10 @@ double Equation_base::calculer_pas_de_temps() const
   int nb_op = nombre_d_operateurs();
   for(int i=0; i<nb_op; i++)
     {
-      if(operateur(i).l_op_base().get_decal_temps()!=1)
-        dt_op = operateur(i).calculer_pas_de_temps();
-      else
-        dt_op = DMAXFLOAT;
+      dt_op = red.valeur(premier + i);
+      // Les operateurs de convection gardent le pas de temps reduit (cf Operateur_Conv_base::dt_stab_conv())
+      if (operateur(i).l_op_base().get_decal_temps()!=1 && sub_type(Operateur_Conv_base,operateur(i).l_op_base()))
+        ref_cast_non_const(Operateur_Conv_base,operateur(i).l_op_base()).fixer_dt_stab_conv(dt_op);
 
       Debog::verifier("Equation_base::calculer_pas_de_temps dt_op 0 ",dt_op);
 
@@ -1948,7 +1985,9 @@ void Equation_base::assembler_blocs(matrices_t matrices, DoubleTab& secmem, cons
 {
   /* mise a zero */
   secmem = 0;
-  for (auto && i_m : matrices) i_m.second->get_set_coeff() = 0;
+  // Les coefficients etant nuls, on peut classer le stencil (fait une seule fois, sorted_ reste vrai ensuite) :
+  // operator()(i,j) fait alors une recherche dichotomique sans effet de bord, utilisable en parallele
+  for (auto && i_m : matrices) i_m.second->get_set_coeff() = 0, i_m.second->sort_stencil();
   /* operateurs, sources, masse */
   for (int i = 0; i < nombre_d_operateurs(); i++)
     operateur(i).l_op_base().ajouter_blocs(matrices, secmem, semi_impl);
@@ -33,6 +33,7 @@
 #include <Sources.h>
 #include <vector>
 
+class Reductions_Differees;
 class Discretisation_base;
 class Schema_Temps_base;
 class Domaine_dis;
@@ -116,6 +117,8 @@ public :
   virtual void associer_pb_base(const Probleme_base&);
   virtual void completer();
   virtual double calculer_pas_de_temps() const;
+  int ajouter_pas_de_temps_locaux(Reductions_Differees&) const;
+  double combiner_pas_de_temps(const Reductions_Differees&, int premier) const;
   void calculer_pas_de_temps_locaux(DoubleTab&) const;  //Computation of local time: Vect of size number of faces of the domain
   Sources& sources();
   const Sources& sources() const;
@@ -291,6 +294,7 @@ private :
 
   mutable DoubleTab NULL_;
   int disable_equation_residual_ = 0;
+  int fusion_operateurs_ = 0; // 1 : diffusion et convection explicites appliquees en un seul balayage si possible
   mutable Parser_U equation_non_resolue_;
   Value_Input_Int eq_non_resolue_input_;
 
@@ -177,6 +177,18 @@ double Operateur::calculer_pas_de_temps() const
   assert(dt_stab==Process::mp_min(dt_stab));
   return dt_stab;
 }
+/*! @brief Calcule le prochain pas de temps sur le processeur courant (le mp_min est fait par l'appelant).
+ *
+ */
+double Operateur::calculer_pas_de_temps_local() const
+{
+  if (equation().equation_non_resolue())
+    return DMAXFLOAT;
+  statistiques().begin_count(dt_counter_);
+  double dt_stab = l_op_base().calculer_dt_stab_local();
+  statistiques().end_count(dt_counter_);
+  return dt_stab;
+}
 /*! @brief Calculate the next local time steps
  *
  */
@@ -130,6 +130,19 @@ double Operateur_base::calculer_dt_stab() const
   return 1.e30;
 }
 
+/*! @brief Calcul dt_stab sur le processeur courant, sans reduction parallele.
+ *
+ * Le minimum sur les processeurs est fait par l'appelant (cf Equation_base::ajouter_pas_de_temps_locaux),
+ *   ce qui permet de regrouper les reductions de tous les operateurs du probleme.
+ *   Par defaut renvoie calculer_dt_stab(), deja reduit (le min d'une valeur deja reduite ne la change pas).
+ *   Une classe qui surcharge cette methode doit aussi surcharger calculer_dt_stab() (en general mp_min(calculer_dt_stab_local())).
+ *
+ */
+double Operateur_base::calculer_dt_stab_local() const
+{
+  return calculer_dt_stab();
+}
+
 void Operateur_base::calculer_dt_local(DoubleTab& dt) const
 {
   Cerr << "You must overload the method " << que_suis_je()
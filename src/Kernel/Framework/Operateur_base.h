@@ -66,12 +66,15 @@ public:
   virtual int has_interface_blocs() const { return 0; }
   virtual void dimensionner_blocs(matrices_t matrices, const tabs_t& semi_impl = { }) const;
   virtual void ajouter_blocs(matrices_t matrices, DoubleTab& secmem, const tabs_t& semi_impl = { }) const;
+  /* ajoute a secmem les contributions de cet operateur et de autre en un seul balayage : renvoie 0 si non supporte (rien n'est ajoute) */
+  virtual int ajouter_fusionne(const Operateur_base& autre, const DoubleTab& inco, DoubleTab& secmem) const { return 0; }
 
   virtual void dimensionner_termes_croises(Matrice_Morse&, const Probleme_base& autre_pb, int nl, int nc) const;
   virtual void ajouter_termes_croises(const DoubleTab& inco, const Probleme_base& autre_pb, const DoubleTab& autre_inco, DoubleTab& resu) const;
   virtual void contribuer_termes_croises(const DoubleTab& inco, const Probleme_base& autre_pb, const DoubleTab& autre_inco, Matrice_Morse& matrice) const;
 
   virtual double calculer_dt_stab() const;
+  virtual double calculer_dt_stab_local() const;
   virtual void calculer_dt_local(DoubleTab&) const; //Local time step calculation
   virtual void completer();
   virtual void mettre_a_jour(double temps);
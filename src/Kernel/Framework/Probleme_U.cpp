@@ -586,6 +586,21 @@ void Probleme_U::getOutputField(const Nom& name,  TrioField& afield) const
   afield.setName(name.getString());
 }
 
+/*! @brief Met a jour un champ de sortie deja obtenu par getOutputField : seules les valeurs sont recopiees
+ *
+ *  dans le tableau existant (le maillage n'est pas reconstruit). Si afield n'est pas compatible, il est reconstruit.
+ *
+ */
+void Probleme_U::updateOutputField(const Nom& name, TrioField& afield) const
+{
+  REF(Champ_Generique_base) ref_ch=findOutputField(name);
+  if (!ref_ch.non_nul())
+    throw WrongArgument(le_nom().getChar(),"updateOutputField",name.getString(),"no output field of that name");
+
+  if (afield.getName() != name.getString() || !update_triofield_values(ref_ch.valeur(), afield))
+    getOutputField(name, afield);
+}
+
 // For now: set a field value provided the field has only one item.
 void Probleme_U::setInputDoubleValue(const Nom& name, const double val)
 {
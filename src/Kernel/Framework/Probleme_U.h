@@ -67,6 +67,7 @@ public :
   virtual void setInputField(const Nom& name, const ICoCo::TrioField& afield);
   virtual void getOutputFieldsNames(Noms& noms) const;
   virtual void getOutputField(const Nom& nameField, ICoCo::TrioField& afield) const;
+  virtual void updateOutputField(const Nom& nameField, ICoCo::TrioField& afield) const;
   virtual void setInputIntValue(const Nom& name, const int& val);
   virtual int getOutputIntValue(const Nom& name) const;
 
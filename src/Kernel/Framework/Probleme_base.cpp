@@ -17,8 +17,10 @@
 #include <Entree_Fichier_base.h>
 #include <Discretisation_base.h>
 #include <Loi_Fermeture_base.h>
+#include <Equilibrage_Charge.h>
 #include <EcrFicCollecteBin.h>
 #include <LecFicDiffuseBin.h>
+#include <Reductions_Differees.h>
 #include <communications.h>
 #include <Probleme_base.h>
 #include <Postraitement.h>
@@ -50,6 +52,7 @@ Implemente_base_sans_destructeur(Probleme_base,"Probleme_base",Probleme_U);
 // XD  attr liste_postraitements liste_post liste_postraitements 1 This block defines the output files to be written during the computation. The output format is lata in order to use OpenDX to draw the results. This block can be divided in one or several sub-blocks that can be written at different frequencies and in different directories. Attention. The directory lata used in this example should be created before running the computation or the lata files will be lost.
 // XD  attr sauvegarde format_file sauvegarde 1 Keyword used when calculation results are to be backed up. When a coupling is performed, the backup-recovery file name must be well specified for each problem. In this case, you must save to different files and correctly specify these files when resuming the calculation.
 // XD  attr sauvegarde_simple format_file sauvegarde_simple 1 The same keyword than Sauvegarde except, the last time step only is saved.
+// XD  attr poids_elements_mesures chaine poids_elements_mesures 1 At each backup, the cost of each element measured since the previous backup (time spent in operators, sources, turbulence models and assembly) is written in this file and the measured load imbalance is appended to the file datafile.equilibrage. The file can be read by the option poids_elements of Partitionneur_Metis to build a balanced partition, the calculation being then resumed with a xyz restart file.
 // XD  attr reprise format_file reprise 1 Keyword to resume a calculation based on the name_file file (see the class format_file). If format_reprise is xyz, the name_file file should be the .xyz file created by the previous calculation. With this file, it is possible to resume a parallel calculation on P processors, whereas the previous calculation has been run on N (N<>P) processors. Should the calculation be resumed, values for the tinit (see schema_temps_base) time fields are taken from the name_file file. If there is no backup corresponding to this time in the name_file, TRUST exits in error.
 //  XD  attr resume_last_time format_file resume_last_time 1 Keyword to resume a calculation based on the name_file file, resume the calculation at the last time found in the file (tinit is set to last time of saved files).
 //  XD ref domaine domaine
@@ -994,9 +997,15 @@ void Probleme_base::preparer_calcul()
 double Probleme_base::calculer_pas_de_temps() const
 {
   Debog::set_nom_pb_actuel(le_nom());
+  // Les pas de temps locaux de tous les operateurs sont reduits en une seule operation collective
+  Reductions_Differees dt_operateurs;
+  std::vector<int> premiers(nombre_d_equations());
+  for(int i=0; i<nombre_d_equations(); i++)
+    premiers[i]=equation(i).ajouter_pas_de_temps_locaux(dt_operateurs);
+  dt_operateurs.reduire();
   double dt=schema_temps().pas_temps_max();
   for(int i=0; i<nombre_d_equations(); i++)
-    dt=std::min(dt,equation(i).calculer_pas_de_temps());
+    dt=std::min(dt,equation(i).combiner_pas_de_temps(dt_operateurs,premiers[i]));
   return dt;
 }
 
@@ -1468,6 +1477,8 @@ void Probleme_base::lire_sauvegarde_reprise(Entree& is, Motcle& motlu)
           else
             is >> restart_file_name_;
         }
+      else if (motlu == "poids_elements_mesures")
+        is >> fichier_poids_elements_mesures_;
       else if (motlu == accolade_fermee)
         break;
       else
@@ -1594,6 +1605,10 @@ void Probleme_base::sauver() const
   Debog::set_nom_pb_actuel(le_nom());
   statistiques().end_count(sauvegarde_counter_, bytes);
   Cout << "[IO] " << statistiques().last_time(sauvegarde_counter_) << " s to write save file." << finl;
+
+  // Poids des elements pour un prochain decoupage equilibre
+  if (fichier_poids_elements_mesures_ != "")
+    Equilibrage_Charge::ecrire_poids_mesures(domaine(), fichier_poids_elements_mesures_, schema_temps().temps_courant());
 }
 
 /*! @brief Finit le postraitement et sauve le probleme dans un fichier.
@@ -214,6 +214,7 @@ protected :
   Nom restart_format_;     // Format for the save restart
   bool restart_done_ = false;         // Has a restart been done?
   bool simple_restart_ = false;       // Restart file name
+  Nom fichier_poids_elements_mesures_; // File for the measured element weights written at each backup (see Equilibrage_Charge)
   int restart_version_ = 155;         // Version number, for example 155 (1.5.5) -> used to manage old restart files
   bool restart_in_progress_ = false;  //true variable only during the time step during which a resumption of computation is carried out
 
@@ -106,6 +106,8 @@ bool Probleme_base_interface_proto::iterateTimeStep_impl(Probleme_base& pb, bool
 
   Debog::set_nom_pb_actuel(pb.le_nom());
   bool ok = pb.schema_temps().iterateTimeStep(converged);
+  // Une seule reduction parallele pour les residus de toutes les equations du probleme
+  pb.schema_temps().reduire_criteres_statio();
 
   // Calculs coeffs echange sur l'instant sur lequel doivent agir les operateurs.
   double tps = pb.schema_temps().temps_defaut();
@@ -19,8 +19,9 @@
 #include <Probleme_base.h>
 #include <Matrice_Morse.h> // necessaire pour visual
 #include <stat_counters.h>
-#include <LecFicDiffuse.h>
+#include <Reductions_Differees.h>
 #include <stat_counters.h>
+#include <EFichier.h>
 #include <Equation.h>
 #include <sys/stat.h>
 #include <SFichier.h>
@@ -173,6 +174,8 @@ int Schema_Temps_base::limpr() const
 void Schema_Temps_base::validateTimeStep()
 {
   statistiques().begin_count(mettre_a_jour_counter_);
+  // Residus encore en attente (schemas ne passant pas par Probleme_base::iterateTimeStep):
+  reduire_criteres_statio();
   // Update the problem:
   Probleme_base& problem=pb_base();
   problem.mettre_a_jour(temps_courant_+dt_);
@@ -509,6 +512,7 @@ Schema_Temps_base::Schema_Temps_base()
   ind_tps_final_atteint=0;
   ind_nb_pas_dt_max_atteint=0;
   ind_temps_cpu_max_atteint=0;
+  stop_lu_=0;
   ind_diff_impl_=0 ;
   seuil_diff_impl_=1.e-6 ;
   impr_diff_impl_=0;
@@ -611,13 +615,15 @@ int Schema_Temps_base::mettre_a_jour()
       else
         Cerr << "The next backup, by security, will take place after " << limite_cpu_sans_sauvegarde_/3600 << " hours of calculation." << finl;
     }
-// GF pour etre sur que tous les proc aient le meme temps ecoule
-  if (je_suis_maitre())
-    {
-      temps_cpu_ecoule_ = statistiques().last_time(temps_total_execution_counter_);
-    }
-
-  envoyer_broadcast(temps_cpu_ecoule_,0);
+  // Points de controle du pas de temps regroupes en une seule operation collective:
+  // - temps CPU ecoule du maitre (GF pour etre sur que tous les proc aient le meme temps ecoule)
+  // - indicateur d'arret du fichier .stop, lu par le maitre une seule fois par pas de temps (voir stop_lu())
+  Reductions_Differees controle;
+  const int i_cpu = controle.ajouter(je_suis_maitre() ? statistiques().last_time(temps_total_execution_counter_) : 0., Comm_Group::COLL_MAX);
+  const int i_stop = controle.ajouter(je_suis_maitre() ? lire_fichier_stop() : 0, Comm_Group::COLL_MAX);
+  controle.reduire();
+  temps_cpu_ecoule_ = controle.valeur(i_cpu);
+  stop_lu_ = (int) controle.valeur(i_stop);
 
 
 #ifdef LIBCCC_USER
@@ -732,23 +738,38 @@ int Schema_Temps_base::reprendre(Entree& is)
  * @return (int) 1 si le fichier (d'extension) .stop contient 1, 0 sinon
  */
 int Schema_Temps_base::stop_lu() const
+{
+  if (get_disable_stop())
+    return 0;
+  if (nb_pas_dt_ < 1)
+    {
+      if (je_suis_maitre())
+        {
+          Nom nomfic(nom_du_cas());
+          nomfic += ".stop";
+          SFichier ficstop(nomfic);
+          ficstop << 0;
+        }
+      return 0;
+    }
+  // Valeur lue par le maitre et diffusee dans mettre_a_jour(), pas de lecture ni de communication ici:
+  return stop_lu_;
+}
+
+/*! @brief Lecture (locale, sur le maitre) du fichier .stop : renvoie 1 s'il contient 1, 0 sinon ou s'il n'existe pas.
+ *
+ */
+int Schema_Temps_base::lire_fichier_stop() const
 {
   int stop_lu_l = 0;
   if (!get_disable_stop())
     {
       Nom nomfic(nom_du_cas());
       nomfic += ".stop";
-      if (nb_pas_dt_ < 1)
+      struct stat f;
+      if (stat(nomfic, &f) == 0)
         {
-          if (je_suis_maitre())
-            {
-              SFichier ficstop(nomfic);
-              ficstop << stop_lu_l;
-            }
-        }
-      else
-        {
-          LecFicDiffuse ficstop(nomfic);
+          EFichier ficstop(nomfic);
           ficstop >> stop_lu_l;
         }
     }
@@ -776,6 +797,18 @@ bool Schema_Temps_base::corriger_dt_calcule(double& dt_calc) const
   double dt = std::min (dt_max_, dt_stab_ * facsec_);
   if (limpr() || (nb_pas_dt_ == 0))
     Cout<<"Time step finally used to solve the next time step (taking into account facsec) : " << dt << " s." << finl;
+  verifier_dt_min(dt);
+  dt_calc=dt;
+  return 1;
+}
+
+/*! @brief Arrete le calcul (apres postraitement et sauvegarde) si le pas de temps dt est inferieur a dt_min_.
+ *
+ * Appelee par corriger_dt_calcule() et par les schemas qui limitent encore dt apres celle-ci.
+ *
+ */
+void Schema_Temps_base::verifier_dt_min(double dt) const
+{
   if ((dt - dt_min_)/(dt+DMINFLOAT) < -1.e-6)
     {
       // Calculation stops if time step dt is less than dt_min
@@ -789,8 +822,6 @@ bool Schema_Temps_base::corriger_dt_calcule(double& dt_calc) const
       pb.sauver();
       Process::exit();
     }
-  dt_calc=dt;
-  return 1;
 }
 
 
@@ -879,7 +910,12 @@ void Schema_Temps_base::ajouter_blocs(matrices_t matrices, DoubleTab& secmem, co
 
 /*! @brief //Actualisation de stationnaire_atteint_ et residu_ (critere residu_<seuil_statio_)
  *
- * @param (double& t) le nouveau temps courant
+ * Seules les normes locales de tab_critere sont calculees ici: elles sont enregistrees dans reductions_statio_
+ *   et reduites avec celles des autres equations par reduire_criteres_statio(), qui met ensuite a jour
+ *   les residus des equations, residu_ et stationnaire_atteint_.
+ *
+ * @param (tab_critere) le tableau dont on prend la norme (en general la derivee en temps de l'inconnue)
+ * @param (equation) l'equation concernee
  */
 void Schema_Temps_base::update_critere_statio(const DoubleTab& tab_critere, Equation_base& equation)
 {
@@ -899,33 +935,67 @@ void Schema_Temps_base::update_critere_statio(const DoubleTab& tab_critere, Equa
             exit();
           }
     }
-  else if (size==1)
+  const bool norme_max = (norm_residu_ == "max");
+  if (!norme_max && norm_residu_ != "L2" && norm_residu_ != "l2")
     {
-      if(norm_residu_ == "max")
-        residu_equation(0) = mp_max_abs_vect(tab_critere);
-      else if (norm_residu_ == "L2" || norm_residu_ == "l2")
-        residu_equation(0) = mp_norme_vect(tab_critere);
-      else
-        {
-          Cerr << "Schema_Temps_base::update_critere_statio : only norm max and norm L2 are allowed to compute residuals ("
-               << norm_residu_ << " not understood)" << finl;
-          Process::exit();
-        }
+      Cerr << "Schema_Temps_base::update_critere_statio : only norm max and norm L2 are allowed to compute residuals ("
+           << norm_residu_ << " not understood)" << finl;
+      Process::exit();
     }
+  const Comm_Group::Collective_Op op = norme_max ? Comm_Group::COLL_MAX : Comm_Group::COLL_SUM;
+  Critere_statio_differe critere;
+  critere.eqn = &equation;
+  critere.premier = reductions_statio_.size();
+  if (size==1)
+    reductions_statio_.ajouter(norme_max ? local_max_abs_vect(tab_critere) : local_carre_norme_vect(tab_critere), op);
   else
     {
-      if(norm_residu_ == "max")
-        mp_max_abs_tab(tab_critere, residu_equation);
-      else if (norm_residu_ == "L2" || norm_residu_ == "l2")
-        mp_norme_tab(tab_critere, residu_equation);
+      DoubleTrav residu_local(size);
+      if (norme_max)
+        local_max_abs_tab(tab_critere, residu_local);
       else
-        {
-          Cerr << "Schema_Temps_base::update_critere_statio : only norm max and norm L2 are allowed to compute residuals ("
-               << norm_residu_ << " not understood)" << finl;
-          Process::exit();
-        }
+        local_carre_norme_tab(tab_critere, residu_local);
+      for (int i=0; i<size; i++)
+        reductions_statio_.ajouter(residu_local(i), op);
+    }
+  critere.i_max_var = critere.i_min_var = -1;
+  if (seuil_statio_relatif_deconseille_ == 2)
+    {
+      critere.i_max_var = reductions_statio_.ajouter(local_max_abs_vect(equation.inconnue().futur()), Comm_Group::COLL_MAX);
+      critere.i_min_var = reductions_statio_.ajouter(local_min_abs_vect(equation.inconnue().futur()), Comm_Group::COLL_MIN);
     }
+  criteres_statio_differes_.push_back(critere);
   equation.set_residuals(tab_critere);
+}
+
+/*! @brief Reduit en une seule operation collective les residus enregistres par update_critere_statio()
+ *
+ * depuis le dernier appel, puis met a jour les residus des equations, residu_ et stationnaire_atteint_.
+ *   Collectif: appele apres la resolution des equations du probleme (cf Probleme_base_interface_proto::iterateTimeStep_impl)
+ *   et au debut de mettre_a_jour() pour les schemas qui ne passent pas par iterateTimeStep.
+ */
+void Schema_Temps_base::reduire_criteres_statio()
+{
+  if (criteres_statio_differes_.empty())
+    return;
+  reductions_statio_.reduire();
+  for (const auto& critere : criteres_statio_differes_)
+    finaliser_critere_statio(critere);
+  criteres_statio_differes_.clear();
+  reductions_statio_.vider();
+}
+
+void Schema_Temps_base::finaliser_critere_statio(const Critere_statio_differe& critere)
+{
+  Equation_base& equation = *critere.eqn;
+  DoubleVect& residu_equation = equation.get_residu();
+  int size = residu_equation.size_array();
+  const bool norme_max = (norm_residu_ == "max");
+  for (int i=0; i<size; i++)
+    {
+      const double r = reductions_statio_.valeur(critere.premier + i);
+      residu_equation(i) = norme_max ? r : sqrt(r);
+    }
   // On calcule le residu_initial_equation sur les 5 premiers pas de temps
   if (seuil_statio_relatif_deconseille_ == 1)
     {
@@ -944,8 +1014,8 @@ void Schema_Temps_base::update_critere_statio(const DoubleTab& tab_critere, Equa
     }
   else if (seuil_statio_relatif_deconseille_ == 2)
     {
-      const double max_var = mp_max_abs_vect(equation.inconnue().futur());
-      const double min_var = mp_min_abs_vect(equation.inconnue().futur());
+      const double max_var = reductions_statio_.valeur(critere.i_max_var);
+      const double min_var = reductions_statio_.valeur(critere.i_min_var);
       residu_equation /= max_var - min_var + 1e-2;
     }
   if (!equation.disable_equation_residual())
@@ -1055,6 +1125,7 @@ void open_dt_ev(IOS_OPEN_MODE mode)
   if (!dt_ev_.is_open())
     {
       Nom fichier(Objet_U::nom_du_cas() + ".dt_ev");
+      dt_ev_.set_asynchrone(true); // effectif seulement avec TRUST_ASYNCHRONOUS_LOG
       dt_ev_.ouvrir(fichier, mode);
       dt_ev_.setf(ios::scientific);
     }
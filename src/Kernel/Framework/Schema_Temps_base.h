@@ -16,11 +16,13 @@
 #ifndef Schema_Temps_base_included
 #define Schema_Temps_base_included
 
+#include <Reductions_Differees.h>
 #include <Interface_blocs.h>
 #include <TRUST_Ref.h>
 #include <TRUSTTab.h>
 #include <Parser_U.h>
 #include <SFichier.h>
+#include <vector>
 #include <math.h>
 
 class Probleme_base;
@@ -117,6 +119,7 @@ public :
   inline const DoubleTab& pas_de_temps_locaux() const;
 
   virtual bool corriger_dt_calcule(double& dt) const;
+  void verifier_dt_min(double dt) const;
   virtual void imprimer(Sortie& os) const;
   virtual int impr(Sortie& os) const;
   void imprimer(Sortie& os,Probleme_base& pb) const;
@@ -134,6 +137,7 @@ public :
   inline double temps_calcul() const;
   virtual inline void changer_temps_courant(const double );
   void update_critere_statio(const DoubleTab& tab_critere, Equation_base& equation);
+  void reduire_criteres_statio();
   inline double facteur_securite_pas() const;
   inline double& facteur_securite_pas();
   virtual int stop() const;
@@ -144,10 +148,13 @@ public :
   inline int stationnaire_atteint() const
   {
     assert(stationnaire_atteint_!=-1);
+    assert(criteres_statio_differes_.empty()); // reduire_criteres_statio() non appele
+
     return stationnaire_atteint_;
   };
   inline int stationnaire_atteint_safe() const { return stationnaire_atteint_; }
   int stop_lu() const;
+  int lire_fichier_stop() const;
   inline int diffusion_implicite() const;
   inline double seuil_diffusion_implicite() const
   {
@@ -316,6 +323,7 @@ protected :
   int ind_tps_final_atteint;
   int ind_nb_pas_dt_max_atteint;
   int ind_temps_cpu_max_atteint;
+  int stop_lu_;                        // Indicateur du fichier .stop, mis a jour une fois par pas de temps dans mettre_a_jour()
   int lu_;
   int ind_diff_impl_ ;
   double seuil_diff_impl_;
@@ -328,6 +336,16 @@ protected :
   int file_allocation_;                // 1 = allocation espace disque (par defaut), 0 sinon
   int max_length_cl_ = -10;
 private:
+  // Residus locaux enregistres par update_critere_statio() et reduits ensemble par reduire_criteres_statio()
+  struct Critere_statio_differe
+  {
+    Equation_base* eqn;
+    int premier;            // indice du premier residu de l'equation dans reductions_statio_
+    int i_max_var, i_min_var; // extremums de l'inconnue (seuil_statio_relatif_deconseille_ == 2), -1 sinon
+  };
+  std::vector<Critere_statio_differe> criteres_statio_differes_;
+  Reductions_Differees reductions_statio_;
+  void finaliser_critere_statio(const Critere_statio_differe&);
   int stationnaire_atteint_;	// Stationary reached by the problem using this scheme
   bool stationnaires_atteints_;	// Stationary reached by the calculation (means all the problems reach stationary)
   SFichier progress_;
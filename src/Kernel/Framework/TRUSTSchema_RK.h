@@ -18,7 +18,9 @@
 
 #include <type_traits>
 #include <Schema_Temps_base.h>
+#include <TRUSTTabs.h>
 #include <Equation.h>
+#include <map>
 
 using ARR1 = std::array<double, 1>; // OK je sais mais bon ... ne demande pas alors :-)
 using ARR2 = std::array<double, 2>;
@@ -49,12 +51,28 @@ class TRUSTSchema_RK : public Schema_Temps_base
   // a surcharger si utile
   void completer() override { /* Do nothing */ }
 
+  void set_param(Param& param) override;
+  bool corriger_dt_calcule(double& dt) const override;
+  int mettre_a_jour() override;
+  void abortTimeStep() override;
+
   friend class RK3_FT; // pour trio
   int faire_un_pas_de_temps_eqn_base(Equation_base& eq) override { return faire_un_pas_de_temps_eqn_base_generique<_ORDRE_>(eq); } // SFINAE :-)
 
 protected:
   static constexpr int NW = 100;
 
+  // Etages conserves d'un pas de temps a l'autre pour chaque equation (evite les allocations a chaque pas)
+  DoubleTabs& stockage_etages(const Equation_base& eqn, const DoubleTab& modele, int nb);
+  // Erreur relative de l'estimation embarquee, cumulee (max) sur les equations du pas de temps courant
+  void estimer_erreur(const DoubleTab& futur, const DoubleTab& delta, int ordre_embarque);
+
+  std::map<const Equation_base *, DoubleTabs> stockage_rk_;
+  double tolerance_rk_ = -1.; // tolerance sur l'erreur embarquee pilotant dt (<= 0 : desactive)
+  double erreur_rk_ = -1.; // erreur du dernier pas valide, utilisee par corriger_dt_calcule (< 0 : pas d'estimation disponible)
+  double erreur_rk_pas_ = -1.; // erreur cumulee sur les equations du pas en cours, transferee dans erreur_rk_ par mettre_a_jour()
+  int ordre_embarque_ = 1;
+
   inline void print_warning(const int nw)
   {
     Cerr << finl << "**** Advice (printed only on the first " << nw << " time steps) ****" << finl;
@@ -88,6 +106,16 @@ private:
     }
   };
 
+  // Solutions embarquees d'ordre inferieur construites sur les memes etages (estimation d'erreur)
+  static constexpr std::array<ARR4, 4> BUTCHER_TAB_EMBARQUE = { {
+      { 1., 0., 0., 0. }, /* Euler, ordre 1 */
+      { 0., 1., 0., 0. }, /* point milieu, ordre 2 */
+      { 0., 1., 0., 0. }, /* point milieu, ordre 2 */
+      { 1. / 4., 0., 3. / 4., 0. } /* Ralston, ordre 2 */
+    }
+  };
+  static constexpr std::array<int, 4> ORDRE_EMBARQUE = { 1, 2, 2, 2 };
+
   // SFINAE template functions
   template<Ordre_RK _O_ = _ORDRE_, int NB>
   std::enable_if_t<_O_ == Ordre_RK::DEUX_WILLIAMSON, std::array<double, NB>>
@@ -147,6 +175,12 @@ constexpr std::array<ARR3, 3> TRUSTSchema_RK<_ORDRE_>::BUTCHER_4_3_8;
 template <Ordre_RK _ORDRE_ >
 constexpr std::array<ARR4, 4> TRUSTSchema_RK<_ORDRE_>::BUTCHER_TAB;
 
+template <Ordre_RK _ORDRE_ >
+constexpr std::array<ARR4, 4> TRUSTSchema_RK<_ORDRE_>::BUTCHER_TAB_EMBARQUE;
+
+template <Ordre_RK _ORDRE_ >
+constexpr std::array<int, 4> TRUSTSchema_RK<_ORDRE_>::ORDRE_EMBARQUE;
+
 template <Ordre_RK _ORDRE_ >
 constexpr ARR2 TRUSTSchema_RK<_ORDRE_>::A2;
 
@@ -16,6 +16,68 @@
 #ifndef TRUSTSchema_RK_TPP_included
 #define TRUSTSchema_RK_TPP_included
 
+#include <Param.h>
+
+template <Ordre_RK _ORDRE_ >
+void TRUSTSchema_RK<_ORDRE_>::set_param(Param& param)
+{
+  Schema_Temps_base::set_param(param);
+  param.ajouter("tolerance_rk", &tolerance_rk_); // XD attr tolerance_rk floattant tolerance_rk 1 Relative tolerance on the error estimated with the embedded scheme. When set, the time step is reduced or increased (factor between 0.2 and 2) to keep this error close to the tolerance. Disabled by default.
+}
+
+template <Ordre_RK _ORDRE_ >
+bool TRUSTSchema_RK<_ORDRE_>::corriger_dt_calcule(double& dt_calc) const
+{
+  if (!Schema_Temps_base::corriger_dt_calcule(dt_calc)) return false;
+  if (tolerance_rk_ > 0 && erreur_rk_ >= 0)
+    {
+      // controleur classique : facteur 0.9 * (1/err)^(1/(p+1)) borne dans [0.2, 2]
+      const double fac = erreur_rk_ > 0 ? 0.9 * pow(erreur_rk_, -1. / (ordre_embarque_ + 1)) : 2.;
+      dt_calc = std::min(dt_calc, pas_de_temps() * std::min(2., std::max(0.2, fac)));
+      if (limpr()) Cout << "Runge-Kutta : estimated error " << erreur_rk_ << ", time step limited to " << dt_calc << " s." << finl;
+      verifier_dt_min(dt_calc); // la limitation a pu faire passer dt sous dt_min
+    }
+  return true;
+}
+
+template <Ordre_RK _ORDRE_ >
+int TRUSTSchema_RK<_ORDRE_>::mettre_a_jour()
+{
+  // l'erreur du pas qui vient d'etre valide pilote le calcul du pas suivant
+  erreur_rk_ = erreur_rk_pas_;
+  erreur_rk_pas_ = -1.;
+  return Schema_Temps_base::mettre_a_jour();
+}
+
+template <Ordre_RK _ORDRE_ >
+void TRUSTSchema_RK<_ORDRE_>::abortTimeStep()
+{
+  erreur_rk_pas_ = -1.;
+  Schema_Temps_base::abortTimeStep();
+}
+
+template <Ordre_RK _ORDRE_ >
+DoubleTabs& TRUSTSchema_RK<_ORDRE_>::stockage_etages(const Equation_base& eqn, const DoubleTab& modele, int nb)
+{
+  DoubleTabs& etages = stockage_rk_[&eqn];
+  // (re)dimensionnement au premier pas ou si la structure de l'inconnue a change
+  if (etages.size() != nb || etages[0].get_md_vector() != modele.get_md_vector() || etages[0].size_totale() != modele.size_totale() || etages[0].line_size() != modele.line_size())
+    {
+      etages.dimensionner_force(nb);
+      for (int i = 0; i < nb; i++) etages[i] = modele;
+    }
+  return etages;
+}
+
+template <Ordre_RK _ORDRE_ >
+void TRUSTSchema_RK<_ORDRE_>::estimer_erreur(const DoubleTab& futur, const DoubleTab& delta, int ordre_embarque)
+{
+  const double d = mp_max_abs_vect(delta), ref = mp_max_abs_vect(futur);
+  const double err = d > 0 ? d / (tolerance_rk_ * std::max(ref, DMINFLOAT)) : 0.;
+  erreur_rk_pas_ = std::max(erreur_rk_pas_, err);
+  ordre_embarque_ = ordre_embarque;
+}
+
 template <Ordre_RK _ORDRE_ > template<Ordre_RK _O_>
 std::enable_if_t<_O_ == Ordre_RK::DEUX_WILLIAMSON || _O_ == Ordre_RK::TROIS_WILLIAMSON || _O_ == Ordre_RK::QUATRE_WILLIAMSON, int>
 TRUSTSchema_RK<_ORDRE_>::faire_un_pas_de_temps_eqn_base_generique(Equation_base& eqn)
@@ -26,21 +88,37 @@ TRUSTSchema_RK<_ORDRE_>::faire_un_pas_de_temps_eqn_base_generique(Equation_base&
   if (nb_pas_dt() >= 0 && nb_pas_dt() <= NW && facsec_ == 1) print_warning(NW);
 
   DoubleTab& xi = eqn.inconnue().valeurs(), &xip1 = eqn.inconnue().futur();
-  DoubleTab present(xi), qi(xi);
+  const bool avec_erreur = tolerance_rk_ > 0;
+  DoubleTabs& etages = stockage_etages(eqn, xi, avec_erreur ? 3 : 2);
+  DoubleTab& present = etages[0], &qi = etages[1];
+  present = xi;
 
+  const DoubleVect *f = &xip1;
   for (int i = 0; i < NB_PTS; i++)
     {
-      // on fait ca : q_i = a_{i-1} * q_{i-1} + dt * f(x_{i-1})
-      qi *= get_a<_ORDRE_,NB_PTS>()[i];
-      qi.ajoute(dt_, eqn.derivee_en_temps_inco(xip1));
+      // on fait ca en un seul passage : q_i = a_{i-1} * q_{i-1} + dt * f(x_{i-1})
+      eqn.derivee_en_temps_inco(xip1);
+      const double a = get_a<_ORDRE_,NB_PTS>()[i];
+      combinaison_lineaire(qi, a, a == 0. ? xip1 : qi, 1, &dt_, &f); // a = 0 : on ne relit pas le q du pas precedent
+      if (i == 0 && avec_erreur) etages[2] = qi; // q_1 = dt * f(x0) : solution embarquee d'Euler x0 + q_1
 
       // on fait ca : x_i = x_{i-1} + b_i * q_i
       xi.ajoute(get_b<_ORDRE_,NB_PTS>()[i], qi);
     }
 
   xip1 = xi;
-  xi -= present;
-  xi /= dt_;
+  if (avec_erreur)
+    {
+      // delta = x_n - (x0 + q_1)
+      const double c[2] = { 1., -1. };
+      const DoubleVect *v[2] = { &xi, &present };
+      combinaison_lineaire(etages[2], -1., etages[2], 2, c, v);
+      estimer_erreur(xip1, etages[2], 1);
+    }
+  // xi = (xi - x0) / dt
+  const double moins_inv_dt = -1. / dt_;
+  const DoubleVect *p = &present;
+  combinaison_lineaire(xi, 1. / dt_, xi, 1, &moins_inv_dt, &p);
   update_critere_statio(xi, eqn);
 
   // Update boundary condition on futur:
@@ -65,28 +143,38 @@ TRUSTSchema_RK<_ORDRE_>::faire_un_pas_de_temps_eqn_base_generique(Equation_base&
   static constexpr int NB_BUTCHER = IS_DEUX ? 0 : ( IS_TROIS ? 1 : ( IS_QUATRE ? 2 : 3 ));
 
   DoubleTab& present = eqn.inconnue().valeurs(), &futur = eqn.inconnue().futur();
-  DoubleTabs ki(NB_PTS); // just for initializing the array structure ...
-
-  for (int i = 0; i < NB_PTS; i++) ki[i] = present;
-
-  DoubleTrav sauv(present);
+  // etages[i] = f(y_i) pour i < NB_PTS, etages[NB_PTS] = y0
+  DoubleTabs& etages = stockage_etages(eqn, present, NB_PTS + 1);
+  DoubleTab& sauv = etages[NB_PTS];
   sauv = present; // sauv = y0
 
+  const DoubleVect *fi[NB_PTS];
+  for (int i = 0; i < NB_PTS; i++) fi[i] = &etages[i];
+  double c[NB_PTS];
+
   // Step 1
-  eqn.derivee_en_temps_inco(ki[0]); // ki[0] = f(y0)
-  ki[0] *= dt_; // ki[0] = h * f(y0)
+  eqn.derivee_en_temps_inco(etages[0]); // f(y0)
 
+  // les k_i = h * f(y_i) ne sont pas formes : dt est porte par les coefficients de chaque combinaison
   for (int step = 1; step < NB_PTS; step++ ) // ATTENTION : ne touche pas !
     {
-      present = sauv; // back to y0
-      for (int i = 0; i < step; i++) present.ajoute(get_butcher_coeff<_ORDRE_,NB_PTS-1>().at(step-1).at(i), ki[i]); // Et ouiiiiiiii :-)
+      for (int i = 0; i < step; i++) c[i] = dt_ * get_butcher_coeff<_ORDRE_,NB_PTS-1>().at(step-1).at(i); // Et ouiiiiiiii :-)
+      combinaison_lineaire(present, 1., sauv, step, c, fi); // present = y0 + sum_i a_ij k_i
+      present.echange_espace_virtuel();
 
-      eqn.derivee_en_temps_inco(ki[step]);
-      ki[step] *= dt_;
+      eqn.derivee_en_temps_inco(etages[step]);
     }
 
-  futur = sauv; // futur = y1 = y0
-  for (int i = 0; i < NB_PTS; i++) futur.ajoute(BUTCHER_TAB.at(NB_BUTCHER).at(i), ki[i]);
+  for (int i = 0; i < NB_PTS; i++) c[i] = dt_ * BUTCHER_TAB.at(NB_BUTCHER).at(i);
+  combinaison_lineaire(futur, 1., sauv, NB_PTS, c, fi); // futur = y1 = y0 + sum_i b_i k_i
+
+  if (tolerance_rk_ > 0)
+    {
+      // ecart a la solution embarquee, present sert de tableau de travail
+      for (int i = 0; i < NB_PTS; i++) c[i] = dt_ * (BUTCHER_TAB.at(NB_BUTCHER).at(i) - BUTCHER_TAB_EMBARQUE.at(NB_BUTCHER).at(i));
+      combinaison_lineaire(present, 0., sauv, NB_PTS, c, fi);
+      estimer_erreur(futur, present, ORDRE_EMBARQUE.at(NB_BUTCHER));
+    }
 
   update_critere_statio(futur, eqn);
 
@@ -0,0 +1,309 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#include <Reductions_Differees.h>
+#include <Equilibrage_Charge.h>
+#include <communications.h>
+#include <Octree_Double.h>
+#include <EcrFicPartage.h>
+#include <stat_counters.h>
+#include <TRUSTTab.h>
+#include <EFichier.h>
+#include <SFichier.h>
+#include <Frontiere.h>
+#include <Domaine.h>
+#include <map>
+
+/*! @brief Temps (en secondes, sur ce processeur) passe depuis le debut du calcul dans les parties dont le cout
+ *
+ *   depend des elements : operateurs, sources, modeles de turbulence et assemblages.
+ *   Les solveurs lineaires ne sont pas comptes : leur temps est domine par les reductions globales
+ *   et il serait le meme sur tous les processeurs quel que soit le decoupage.
+ *   Appel collectif.
+ */
+double Equilibrage_Charge::cout_local_cumule()
+{
+  const Stat_Counter_Id* compteurs[] = { &convection_counter_, &diffusion_counter_, &gradient_counter_, &divergence_counter_,
+                                         &source_counter_, &nut_counter_, &assemblage_sys_counter_
+                                       };
+  double cout = 0.;
+  for (const Stat_Counter_Id* compteur : compteurs)
+    {
+      Stat_Results resultat;
+      statistiques().get_stats(*compteur, resultat);
+      cout += resultat.time;
+    }
+  return cout;
+}
+
+/*! @brief Classe chaque element reel de dom selon son cout attendu : ELEM_INTERIEUR, ELEM_BORD (touche une frontiere
+ *
+ *   avec condition limite) ou ELEM_JOINT (touche un joint, prioritaire). Les voisins des faces de frontiere doivent etre remplis
+ *   (domaine discretise), sinon les elements restent ELEM_INTERIEUR.
+ *
+ */
+void Equilibrage_Charge::classer_elements(const Domaine& dom, ArrOfInt& categorie)
+{
+  const int nb_elem = dom.nb_elem();
+  categorie.resize_array(nb_elem);
+  categorie = ELEM_INTERIEUR;
+  auto marquer = [&](const Frontiere& fr, int cat)
+  {
+    const IntTab& voisins = fr.faces().voisins();
+    if (voisins.dimension(0) != fr.nb_faces())
+      return;
+    for (int f = 0; f < fr.nb_faces(); f++)
+      for (int i = 0; i < 2; i++)
+        {
+          const int e = voisins(f, i);
+          if (e >= 0 && e < nb_elem)
+            categorie[e] = std::max(categorie[e], cat);
+        }
+  };
+  for (int i = 0; i < dom.nb_front_Cl(); i++)
+    marquer(dom.frontiere(i), ELEM_BORD);
+  for (int i = 0; i < dom.nb_joints(); i++)
+    marquer(dom.joint(i), ELEM_JOINT);
+}
+
+/*! @brief Ecrit le poids de chaque element reel (centre de gravite puis poids) dans nom_fichier et ajoute le desequilibre mesure
+ *
+ *   dans nom_du_cas.equilibrage. Le cout mesure est celui ecoule depuis l'ecriture precedente dans le meme fichier.
+ *
+ *   Les compteurs ne donnent qu'un temps par processeur. Le cout par element est estime par categorie d'element
+ *   (cf classer_elements) : on ajuste au sens des moindres carres, sur l'ensemble des processeurs, le temps mesure
+ *   T_p ~ somme_k c_k n_pk, ou n_pk est le nombre d'elements de la categorie k sur le processeur p. Le probleme est
+ *   regularise vers le cout moyen par element (sans cela il est singulier s'il y a moins de processeurs que de categories).
+ *   Le cout de chaque element est ensuite mis a l'echelle du temps mesure sur son processeur, qui reste donc exact:
+ *   poids(e) = POIDS_REFERENCE * c_k(e) * T_p / (somme_k c_k n_pk) / cout moyen par element.
+ *   Appel collectif.
+ *
+ */
+void Equilibrage_Charge::ecrire_poids_mesures(const Domaine& dom, const Nom& nom_fichier, double temps)
+{
+  static std::map<std::string, double> cout_precedent; // par fichier, plusieurs problemes pouvant ecrire leurs poids
+  const double cout_cumule = cout_local_cumule();
+  double& precedent = cout_precedent[nom_fichier.getString()];
+  const double cout = cout_cumule - precedent;
+  precedent = cout_cumule;
+
+  const int nb_elem = dom.nb_elem();
+  ArrOfInt categorie;
+  classer_elements(dom, categorie);
+  double n[NB_CATEGORIES] = { 0., 0., 0. };
+  for (int e = 0; e < nb_elem; e++)
+    n[categorie[e]] += 1.;
+
+  // Toutes les sommes sur les processeurs en une seule operation collective
+  Reductions_Differees sommes;
+  int i_a[NB_CATEGORIES][NB_CATEGORIES], i_b[NB_CATEGORIES], i_n[NB_CATEGORIES];
+  for (int k = 0; k < NB_CATEGORIES; k++)
+    {
+      for (int l = 0; l < NB_CATEGORIES; l++)
+        i_a[k][l] = sommes.ajouter(n[k] * n[l], Comm_Group::COLL_SUM);
+      i_b[k] = sommes.ajouter(n[k] * cout, Comm_Group::COLL_SUM);
+      i_n[k] = sommes.ajouter(n[k], Comm_Group::COLL_SUM);
+    }
+  const int i_total = sommes.ajouter(cout, Comm_Group::COLL_SUM), i_max = sommes.ajouter(cout, Comm_Group::COLL_MAX);
+  sommes.reduire();
+
+  const double cout_total = sommes.valeur(i_total);
+  const double cout_max = sommes.valeur(i_max);
+  const double cout_moyen = cout_total / Process::nproc();
+  const double desequilibre = (cout_moyen > 0.) ? cout_max / cout_moyen : 1.;
+  double nb_elem_total = 0.;
+  for (int k = 0; k < NB_CATEGORIES; k++)
+    nb_elem_total += sommes.valeur(i_n[k]);
+  const double cout_elem_moyen = (nb_elem_total > 0) ? cout_total / nb_elem_total : 0.;
+
+  // Moindres carres regularises : (A + lambda N) c = b + lambda N cout_elem_moyen
+  double c[NB_CATEGORIES];
+  for (int k = 0; k < NB_CATEGORIES; k++)
+    c[k] = cout_elem_moyen;
+  if (cout_elem_moyen > 0.)
+    {
+      double diag_max = 0.;
+      for (int k = 0; k < NB_CATEGORIES; k++)
+        diag_max = std::max(diag_max, sommes.valeur(i_a[k][k]));
+      const double lambda = 1.e-3 * diag_max / nb_elem_total;
+      double A[NB_CATEGORIES][NB_CATEGORIES + 1];
+      for (int k = 0; k < NB_CATEGORIES; k++)
+        {
+          for (int l = 0; l < NB_CATEGORIES; l++)
+            A[k][l] = sommes.valeur(i_a[k][l]);
+          A[k][k] += lambda * sommes.valeur(i_n[k]) + (sommes.valeur(i_n[k]) > 0. ? 0. : 1.); // categorie absente : c_k = cout moyen
+          A[k][NB_CATEGORIES] = sommes.valeur(i_b[k]) + lambda * sommes.valeur(i_n[k]) * cout_elem_moyen
+                                + (sommes.valeur(i_n[k]) > 0. ? 0. : cout_elem_moyen);
+        }
+      // Elimination de Gauss (matrice symetrique definie positive)
+      for (int k = 0; k < NB_CATEGORIES; k++)
+        for (int l = k + 1; l < NB_CATEGORIES; l++)
+          {
+            const double f = A[l][k] / A[k][k];
+            for (int m = k; m <= NB_CATEGORIES; m++)
+              A[l][m] -= f * A[k][m];
+          }
+      for (int k = NB_CATEGORIES - 1; k >= 0; k--)
+        {
+          double x = A[k][NB_CATEGORIES];
+          for (int l = k + 1; l < NB_CATEGORIES; l++)
+            x -= A[k][l] * c[l];
+          // Un cout negatif ou quasi nul n'a pas de sens physique (bruit de mesure) : on borne a 10% du cout moyen
+          c[k] = std::max(x / A[k][k], 0.1 * cout_elem_moyen);
+        }
+    }
+  // Mise a l'echelle du temps mesure sur ce processeur
+  double cout_modele = 0.;
+  for (int k = 0; k < NB_CATEGORIES; k++)
+    cout_modele += c[k] * n[k];
+  const double echelle = (cout_modele > 0. && cout > 0.) ? cout / cout_modele : 1.;
+
+  DoubleTab xp;
+  dom.calculer_centres_gravite(xp);
+  const int dim = xp.dimension(1);
+
+  EcrFicPartage fic;
+  fic.ouvrir(nom_fichier);
+  fic.setf(ios::scientific);
+  fic.precision(Objet_U::format_precision_geom);
+  if (Process::je_suis_maitre())
+    fic << (int)nb_elem_total << " " << dim << finl;
+  Process::barrier();
+  fic.lockfile();
+  for (int e = 0; e < nb_elem; e++)
+    {
+      int poids = POIDS_REFERENCE;
+      if (cout_elem_moyen > 0.)
+        poids = std::max(1, (int)(POIDS_REFERENCE * c[categorie[e]] * echelle / cout_elem_moyen + 0.5));
+      for (int j = 0; j < dim; j++)
+        fic << xp(e, j) << " ";
+      fic << poids << finl;
+    }
+  fic.unlockfile();
+  Process::barrier();
+  fic.syncfile();
+  fic.close();
+
+  if (Process::je_suis_maitre())
+    {
+      static bool entete_ecrite = false;
+      Nom nom_rapport(Objet_U::nom_du_cas());
+      nom_rapport += ".equilibrage";
+      SFichier rapport(nom_rapport, entete_ecrite ? (ios::out | ios::app) : ios::out);
+      if (!entete_ecrite)
+        rapport << "# Temps Fichier_poids Desequilibre(max/moyenne) Cout_max(s) Cout_moyen(s) Cout_elem_interieur/bord/joint(s)" << finl;
+      entete_ecrite = true;
+      rapport << temps << " " << nom_fichier << " " << desequilibre << " " << cout_max << " " << cout_moyen;
+      for (int k = 0; k < NB_CATEGORIES; k++)
+        rapport << " " << c[k];
+      rapport << finl;
+      Cerr << "[Equilibrage] Measured load imbalance (max/mean of operator time per process) = " << desequilibre
+           << ", element weights written in " << nom_fichier << finl;
+    }
+}
+
+/*! @brief Lit un fichier ecrit par ecrire_poids_mesures et affecte les poids aux elements du domaine (complet) dom
+ *
+ *   en retrouvant chaque element par son centre de gravite. Les elements absents du fichier gardent POIDS_REFERENCE.
+ *
+ */
+void Equilibrage_Charge::lire_poids(const Domaine& dom, const Nom& nom_fichier, ArrOfInt& poids)
+{
+  EFichier fic;
+  fic.ouvrir(nom_fichier);
+  if (!fic.good())
+    {
+      Cerr << "Error in Equilibrage_Charge::lire_poids" << finl;
+      Cerr << " Failed to open file " << nom_fichier << finl;
+      Process::exit();
+    }
+  int nb_lignes, dim;
+  fic >> nb_lignes >> dim;
+
+  DoubleTab xp;
+  dom.calculer_centres_gravite(xp);
+  const int nb_elem = dom.nb_elem();
+  if (dim != xp.dimension(1))
+    {
+      Cerr << "Error in Equilibrage_Charge::lire_poids" << finl;
+      Cerr << " The file " << nom_fichier << " is written in dimension " << dim << " but the domain has dimension " << xp.dimension(1) << finl;
+      Process::exit();
+    }
+  poids.resize_array(nb_elem);
+  poids = POIDS_REFERENCE;
+
+  // Tolerance de recherche relative a la taille du domaine
+  double taille = 0.;
+  for (int j = 0; j < dim; j++)
+    {
+      double xmin = DMAXFLOAT, xmax = -DMAXFLOAT;
+      for (int e = 0; e < nb_elem; e++)
+        {
+          xmin = std::min(xmin, xp(e, j));
+          xmax = std::max(xmax, xp(e, j));
+        }
+      taille = std::max(taille, xmax - xmin);
+    }
+  const double epsilon = 1.e-8 * std::max(taille, 1.);
+
+  Octree_Double octree;
+  octree.build_nodes(xp, 0 /* pas d'elements virtuels */);
+  ArrOfDouble centre(dim);
+  ArrOfInt candidats;
+  int nb_non_trouves = 0;
+  for (int i = 0; i < nb_lignes; i++)
+    {
+      for (int j = 0; j < dim; j++)
+        fic >> centre[j];
+      int p;
+      fic >> p;
+      octree.search_elements_box(centre, epsilon, candidats);
+      const int e = Octree_Double::search_nodes_close_to(centre, xp, candidats, epsilon);
+      if (e < 0)
+        nb_non_trouves++;
+      else
+        poids[e] = p;
+    }
+  fic.close();
+  Cerr << "Element weights read from " << nom_fichier << " for " << nb_lignes - nb_non_trouves << " elements" << finl;
+  if (nb_non_trouves > 0)
+    Cerr << "WARNING: " << nb_non_trouves << " centers of the file " << nom_fichier << " do not match any element of the domain "
+         << dom.le_nom() << " (default weight " << (int)POIDS_REFERENCE << " used)" << finl;
+}
+
+/*! @brief Imprime le nombre d'elements et la charge (somme des poids) prevus par partie, et le desequilibre correspondant.
+ *
+ */
+void Equilibrage_Charge::imprimer_desequilibre_prevu(const ArrOfInt& poids, const IntVect& elem_part, int nb_parts)
+{
+  if (nb_parts <= 0)
+    return;
+  ArrOfDouble charge(nb_parts);
+  ArrOfInt nb_elem_part(nb_parts);
+  double charge_totale = 0.;
+  const int n = std::min(poids.size_array(), elem_part.size_array());
+  for (int e = 0; e < n; e++)
+    {
+      charge[elem_part[e]] += poids[e];
+      nb_elem_part[elem_part[e]]++;
+      charge_totale += poids[e];
+    }
+  for (int p = 0; p < nb_parts; p++)
+    Cerr << "Part " << p << " : " << nb_elem_part[p] << " elements, weight " << charge[p] << finl;
+  const double charge_moyenne = charge_totale / nb_parts;
+  const double charge_max = max_array(charge);
+  Cerr << "Expected load imbalance with the element weights (max/mean of the weights per part) = "
+       << ((charge_moyenne > 0.) ? charge_max / charge_moyenne : 1.) << finl;
+}
@@ -0,0 +1,49 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#ifndef Equilibrage_Charge_included
+#define Equilibrage_Charge_included
+
+#include <TRUSTTabs_forward.h>
+#include <Nom.h>
+
+class Domaine;
+
+/*! @brief Poids des elements mesures en cours de calcul, pour reequilibrer la charge lors d'un nouveau decoupage.
+ *
+ *   En cours de calcul (a chaque sauvegarde, option poids_elements_mesures du probleme), chaque processeur mesure
+ *   le temps passe dans les operateurs, sources, modeles de turbulence et assemblages depuis l'ecriture precedente.
+ *   Un cout par categorie d'element (interieur, bord, joint) est ajuste sur ces mesures, d'ou un poids par element. Les poids sont ecrits avec le centre de gravite de chaque element, ce qui les
+ *   rend independants du decoupage courant. Un rapport de desequilibre est ajoute au fichier nom_du_cas.equilibrage.
+ *
+ *   Le fichier est relu par Partitionneur_Metis (option poids_elements) sur le domaine complet. Le calcul est ensuite
+ *   repris sur le nouveau decoupage a partir d'une sauvegarde xyz, independante du decoupage.
+ *
+ */
+class Equilibrage_Charge
+{
+public:
+  static void ecrire_poids_mesures(const Domaine& dom, const Nom& nom_fichier, double temps);
+  static void lire_poids(const Domaine& dom, const Nom& nom_fichier, ArrOfInt& poids);
+  static void imprimer_desequilibre_prevu(const ArrOfInt& poids, const IntVect& elem_part, int nb_parts);
+
+  static constexpr int POIDS_REFERENCE = 100; // poids d'un element de cout moyen
+  enum Categorie_Element { ELEM_INTERIEUR = 0, ELEM_BORD = 1, ELEM_JOINT = 2, NB_CATEGORIES = 3 };
+  static void classer_elements(const Domaine& dom, ArrOfInt& categorie);
+protected:
+  static double cout_local_cumule();
+};
+
+#endif
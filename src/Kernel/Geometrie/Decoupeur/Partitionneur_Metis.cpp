@@ -20,6 +20,7 @@
 
 #include <communications.h>
 #include <Domain_Graph.h>
+#include <Equilibrage_Charge.h>
 #include <metis.h>
 
 inline void not_implemented(const Nom& chaine)
@@ -66,6 +67,7 @@ void Partitionneur_Metis::set_param(Param& param)
   param.ajouter_non_std("initial_partition_type",(this));
   param.ajouter_non_std("refinement_type",(this));
   param.ajouter_flag("use_weights",&use_weights_);
+  param.ajouter("poids_elements",&fichier_poids_elements_); // poids des elements mesures en cours de calcul (option poids_elements_mesures du probleme)
   param.ajouter_flag("use_segment_to_build_connectivite_elem_elem",&use_segment_to_build_connectivite_elem_elem_); // option pour construire le grpah a partir des liens (segment) pour reseau electrique, sides ....
 }
 
@@ -171,6 +173,24 @@ void Partitionneur_Metis::construire_partition(IntVect& elem_part, int& nb_parts
       graph.construire_graph_from_segment(ref_domaine_.valeur(), use_weights_);
 
     }
+  ArrOfInt poids_elements;
+  if (fichier_poids_elements_ != "")
+    {
+      if (use_segment_to_build_connectivite_elem_elem_)
+        {
+          Cerr << "Error in Partitionneur_Metis: poids_elements can't be used with use_segment_to_build_connectivite_elem_elem" << finl;
+          exit();
+        }
+      if (use_weights_)
+        {
+          Cerr << "Error in Partitionneur_Metis: poids_elements can't be used with use_weights." << finl;
+          Cerr << "Remove one of the two options." << finl;
+          exit();
+        }
+      Equilibrage_Charge::lire_poids(ref_domaine_.valeur(), fichier_poids_elements_, poids_elements);
+      assert(poids_elements.size_array() == graph.nvtxs);
+      graph.vwgts = poids_elements;
+    }
   std::vector<int> partition(graph.nvtxs);
   int int_parts = nb_parties_;
   int edgecut = 0; // valeur renvoyee par metis (nombre total de faces de joint)
@@ -260,6 +280,8 @@ void Partitionneur_Metis::construire_partition(IntVect& elem_part, int& nb_parts
   elem_part.resize(n);
   for (int i = 0; i < n; i++)
     elem_part[i] = partition[i];
+  if (poids_elements.size_array() > 0)
+    Equilibrage_Charge::imprimer_desequilibre_prevu(poids_elements, elem_part, nb_parties_);
 
   // Correction de la partition pour la periodicite. (***)
   if (graph_elements_perio.get_nb_lists() > 0)
@@ -61,6 +61,8 @@ private:
   //  valide dans avec ou sans l'option car on verifie de toutes facons
   //  la partition generee par metis (voir (***))
   int use_weights_;
+  // Fichier des poids des elements (Equilibrage_Charge) : les parties equilibrent la somme des poids et non le nombre d'elements
+  Nom fichier_poids_elements_;
   int use_segment_to_build_connectivite_elem_elem_;
 
 };
@@ -1337,7 +1337,8 @@ void DomaineCutter::ecrire_domaines(const Nom& basename, const Decouper::Domaine
   //To detect my parts (when running in parallel)
   ArrOfInt myDomaines(nb_parties_);
   myDomaines = 0;
-  ArrsOfInt otherProcDomaines(Process::nproc());
+  // Pour chaque partie, nombre de processeurs qui en detiennent un fragment
+  ArrOfInt nb_fragments(nb_parties_);
 
   //if some domaines are splitted between multiple procs,
   //we assign consecutive indices to each of its fragment
@@ -1370,70 +1371,34 @@ void DomaineCutter::ecrire_domaines(const Nom& basename, const Decouper::Domaine
       if(loop == reorder)
         {
           // check to see which part is shared between multiple processors:
-          // 1- everyone sends the number of the parts that belong to them to the master process
-          // 2- master process will assign a unique positive number to each fragment of a shared domaine
+          // 1- a sum over the procs gives the number of fragments of each part
+          // 2- a partial sum over the procs of lower rank gives the index of my fragment
           // 3- if a part is owned by a single process, it is indicated with the index -1
-          // 4- the master process scatters the indices to all the proc
-          ArrsOfInt domaines_indices(Process::nproc());
-
+          // 4- an empty part is written by the master process
+          // Only collective operations on arrays of size nb_parties_ are involved: no processor
+          // (not even the master) stores or exchanges nproc*nb_parties_ values.
           for(int i=0; i < nbelem; i++)
             {
               const int part = elem_part[i];
               myDomaines[part] = 1;
             }
 
-          for(int p=0; p<Process::nproc(); p++)
-            {
-              if(p==0)
-                otherProcDomaines[p] = myDomaines;
-              else
-                {
-                  otherProcDomaines[p].resize_array(nb_parties_);
-                  otherProcDomaines[p] = 0;
-                }
-            }
-          if(Process::je_suis_maitre())
-            {
-              for(int p=0; p<Process::nproc(); p++)
-                {
-                  domaines_indices[p].resize_array(nb_parties_);
-                  domaines_indices[p] = -2;
-                  if(p!=0)
-                    recevoir(otherProcDomaines[p], p, 0, p+2001);
-                }
-
-              for(int part=0; part<nb_parties_; part++)
-                {
-                  int s = 0;
-                  for(int proc=0; proc < Process::nproc(); proc++)
-                    {
-                      if(otherProcDomaines[proc][part])
-                        domaines_indices[proc][part] = s++;
-                    }
-
-                  if(s<=1)
-                    {
-                      if(s==0)   //empty part: master process will write it
-                        myDomaines[part] = 1;
-
-                      //part is detained by a single proc
-                      for(int proc=0; proc < Process::nproc(); proc++)
-                        domaines_indices[proc][part] = -1;
-                    }
-                }
+          nb_fragments = myDomaines;
+          mp_sum_for_each_item(nb_fragments);
+          ArrOfInt rang_fragment(myDomaines);
+          mp_collective_op(rang_fragment, Comm_Group::COLL_PARTIAL_SUM);
 
-              for(int p=0; p<Process::nproc(); p++)
+          for(int part=0; part<nb_parties_; part++)
+            {
+              if(nb_fragments[part] <= 1)
                 {
-                  if(p==0)
-                    domaines_index = domaines_indices[p];
-                  else
-                    envoyer(domaines_indices[p], 0, p, p+2002);
+                  if(nb_fragments[part] == 0 && Process::je_suis_maitre())   //empty part: master process will write it
+                    myDomaines[part] = 1;
+                  //part is detained by a single proc
+                  domaines_index[part] = -1;
                 }
-            }
-          else
-            {
-              envoyer(myDomaines, Process::me(), 0, Process::me()+2001);
-              recevoir(domaines_index, 0, Process::me(), Process::me()+2002);
+              else if(myDomaines[part])
+                domaines_index[part] = rang_fragment[part];
             }
 
           if (format == Decouper::HDF5_SINGLE)  // create HDF5 file only once!
@@ -1441,45 +1406,41 @@ void DomaineCutter::ecrire_domaines(const Nom& basename, const Decouper::Domaine
               fic_hdf.create(nom_fichier_hdf5);
               if(Process::is_parallel())
                 {
-                  // creating datasets
+                  // creating datasets (nb_fragments is known by every proc, no broadcast needed)
                   Noms dataset_names;
-                  if(Process::je_suis_maitre())
+                  for(int part=0; part<nb_parties_; part++)
                     {
-                      for(int part=0; part<nb_parties_; part++)
+                      if(nb_fragments[part] <= 1)
                         {
-                          if(domaines_index[part] == -1)
+                          std::string dname = "/zone_"  + std::to_string(part);
+                          Nom dataset_name(dname);
+                          dataset_names.add(dataset_name);
+                        }
+                      else
+                        {
+                          for(int i_frag=0; i_frag < nb_fragments[part]; i_frag++)
                             {
-                              std::string dname = "/zone_"  + std::to_string(part);
+                              std::string dname = "/zone_"  + std::to_string(part) + "_" + std::to_string(i_frag);
                               Nom dataset_name(dname);
                               dataset_names.add(dataset_name);
                             }
-                          else
-                            {
-                              for(int proc=0; proc < Process::nproc(); proc++)
-                                {
-                                  if(domaines_indices[proc][part] >=0)
-                                    {
-                                      std::string dname = "/zone_"  + std::to_string(part) + "_" + std::to_string(domaines_indices[proc][part]);
-                                      Nom dataset_name(dname);
-                                      dataset_names.add(dataset_name);
-                                    }
-                                }
-                            }
                         }
-
                     }
 
                   // estimation of an upper bound of the datasets' size
                   int ipart = 0;
-                  while(!myDomaines[ipart]) ipart++;
-                  Domaine dom_tmp;
-                  construire_sous_domaine(ipart, dc_correspondance, dom_tmp);
-                  Sortie_Brute os_tmp;
-                  writeData(dom_tmp, os_tmp);
-                  double sz_ = (double)os_tmp.get_size();
+                  while(ipart < nb_parties_ && !myDomaines[ipart]) ipart++;
+                  double sz_ = 0.;
+                  if (ipart < nb_parties_)
+                    {
+                      Domaine dom_tmp;
+                      construire_sous_domaine(ipart, dc_correspondance, dom_tmp);
+                      Sortie_Brute os_tmp;
+                      writeData(dom_tmp, os_tmp);
+                      sz_ = (double)os_tmp.get_size();
+                    }
                   sz_ *= 1.5;
                   sz_ = Process::mp_max(sz_);
-                  envoyer_broadcast(dataset_names,0);
                   long sz_l = lround(sz_);
                   fic_hdf.create_datasets(dataset_names, sz_l);
                 }
@@ -1710,9 +1671,11 @@ void DomaineCutter::ecrire_domaines(const Nom& basename, const Decouper::Domaine
         {
           for(int proc=1; proc<Process::nproc(); proc++)
             {
+              ArrOfInt proc_domaines;
+              recevoir(proc_domaines, proc, 0, proc+2001);
               for(int i_part=0; i_part<nb_parties_; i_part++)
                 {
-                  if(otherProcDomaines[proc][i_part])
+                  if(proc_domaines[i_part])
                     {
                       ArrOfInt tmp_neighbours;
 
@@ -1772,6 +1735,7 @@ void DomaineCutter::ecrire_domaines(const Nom& basename, const Decouper::Domaine
         }
       else
         {
+          envoyer(myDomaines, Process::me(), 0, Process::me()+2001);
           for(int i_part=0; i_part < nb_parties_; i_part++)
             if(myDomaines[i_part])
               envoyer(Neighbours[i_part], Process::me(), 0, Process::me()+2003);
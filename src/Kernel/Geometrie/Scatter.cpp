@@ -28,6 +28,7 @@
 #include <MD_Vector_tools.h>
 #include <MD_Vector_std.h>
 #include <unistd.h> // PGI
+#include <climits>
 #include <Poly_geom_base.h>
 #include <Entree_Brute.h>
 #include <Comm_Group_MPI.h>
@@ -236,12 +237,12 @@ Entree& Scatter::interpreter(Entree& is)
   Cerr << "End Distribue_domaines" << finl;
 
   Cerr << "\nQuality of partitioning --------------------------------------------" << finl;
-  int total_nb_elem = Process::mp_sum(dom.nb_elem());
+  const trustIdType total_nb_elem = Process::mp_sum_as_long(dom.nb_elem());
   Cerr << "\nTotal nb of elements = " << total_nb_elem << finl;
   Cerr << "Number of Domaines : " << Process::nproc() << finl;
   double min_element_domaine = mp_min(dom.nb_elem());
   double max_element_domaine = mp_max(dom.nb_elem());
-  double mean_element_domaine = total_nb_elem / Process::nproc();
+  double mean_element_domaine = (double) total_nb_elem / Process::nproc();
   Cerr << "Min number of elements on a Domaine = " << min_element_domaine << finl;
   Cerr << "Max number of elements on a Domaine = " << max_element_domaine << finl;
   Cerr << "Mean number of elements per Domaine = " << (int)(mean_element_domaine) << finl;
@@ -1513,7 +1514,15 @@ void Traduction_Indice_Global_Local::initialiser(const MD_Vector& md_items)
   MD_Vector_tools::creer_tableau_distribue(md_items, table_);
 
   const int nb_entites = md_items.valeur().get_nb_items_tot();
-  const int decal = mppartial_sum(nb_entites);
+  // Decalage calcule sur 64 bits ; table_ etant un IntTab, la numerotation globale doit cependant tenir sur un int
+  const trustIdType decal_long = Process::mppartial_sum_as_long(nb_entites);
+  if (decal_long + nb_entites > INT_MAX)
+    {
+      Cerr << "Error in Traduction_Indice_Global_Local::initialiser : the global numbering reaches " << decal_long + nb_entites
+           << " and exceeds the capacity of an int (" << INT_MAX << ")." << finl;
+      Process::exit();
+    }
+  const int decal = (int) decal_long;
   premier_indice_global_ = decal;
 
   int i;
@@ -65,6 +65,31 @@ void build_triofield(const Champ_base& ch, const Domaine_dis_base& dom_dis, ICoC
   affecte_double_avec_doubletab(&afield._field, vals);
 }
 
+/*! @brief Mise a jour des seules valeurs d'un TrioField deja construit par build_triofield (maillage inchange).
+ *
+ * Les valeurs sont recopiees dans le tableau deja alloue de afield : pas de reconstruction du maillage,
+ *   pas d'allocation. Renvoie false si afield n'est pas compatible avec le champ (il faut alors le reconstruire).
+ *
+ */
+bool update_triofield_values(const Champ_Generique_base& ch, ICoCo::TrioField& afield)
+{
+  if (!afield._field || !afield._has_field_ownership)
+    return false;
+
+  Champ espace_stockage;
+  const Champ_base& champ_ecriture = ch.get_champ(espace_stockage);
+  const DoubleTab& vals = champ_ecriture.valeurs();
+  const int nb_comp = vals.nb_dim() > 1 ? vals.dimension(1) : 1;
+  // les items reels sont en tete du tableau, seuls ceux-ci sont vus par le couplage
+  const int nb_reels = afield.nb_values() * afield._nb_field_components;
+  if (nb_comp != afield._nb_field_components || vals.size_array() < nb_reels)
+    return false;
+
+  afield._time1 = afield._time2 = ch.get_time();
+  memcpy(afield._field, vals.addr(), nb_reels * sizeof(double));
+  return true;
+}
+
 void build_triomesh(const Domaine_dis_base& dom_dis, ICoCo::TrioField& afield, int type, int loc_faces)
 {
   const Domaine_VF& zvf = ref_cast(Domaine_VF, dom_dis);
@@ -307,6 +332,38 @@ MEDDoubleField build_medfield(const Champ_Generique_base& ch)
   return build_medfield(fl);
 }
 
+/*! @brief Mise a jour des valeurs d'un MEDDoubleField deja construit par build_medfield : le maillage MEDCoupling est conserve
+ *
+ *   et les valeurs sont ecrites directement dans le DataArrayDouble du champ. Le tableau est ensuite marque comme modifie
+ *   (declareAsNew) pour que les consommateurs MEDCoupling (interpolation, ParaMEDMEM) voient le changement.
+ *   Renvoie false si medfield n'est pas compatible avec le champ.
+ *
+ */
+bool update_medfield_values(const Champ_Generique_base& ch, MEDDoubleField& medfield)
+{
+#ifdef OLD_MEDCOUPLING
+  ParaMEDMEM::MEDCouplingFieldDouble *field = const_cast<ParaMEDMEM::MEDCouplingFieldDouble *>(medfield.getField());
+  ParaMEDMEM::DataArrayDouble *fieldArr = field ? field->getArray() : nullptr;
+#else
+  MEDCoupling::MEDCouplingFieldDouble *field = medfield.getMCField();
+  MEDCoupling::DataArrayDouble *fieldArr = field ? field->getArray() : nullptr;
+#endif
+  if (!field || !fieldArr || !field->getMesh())
+    return false;
+
+  Champ espace_stockage;
+  const Champ_base& champ_ecriture = ch.get_champ(espace_stockage);
+  const DoubleTab& vals = champ_ecriture.valeurs();
+  const int nb_comp = vals.nb_dim() > 1 ? vals.dimension(1) : 1;
+  const int nb_tuples = (int)fieldArr->getNumberOfTuples();
+  if (nb_comp != (int)fieldArr->getNumberOfComponents() || nb_tuples != (int)field->getNumberOfTuplesExpected() || vals.size_array() < nb_tuples * nb_comp)
+    return false;
+
+  std::copy(vals.addr(), vals.addr() + nb_tuples * nb_comp, fieldArr->getPointer());
+  fieldArr->declareAsNew();
+  field->setTime(ch.get_time(), 0, 0);
+  return true;
+}
 
 #else
 namespace ICoCo
@@ -327,4 +384,10 @@ ICoCo::MEDDoubleField build_medfield(const Champ_Generique_base& ch)
   Process::exit();
   throw;
 }
+bool update_medfield_values(const Champ_Generique_base& ch, ICoCo::MEDDoubleField& medfield)
+{
+  Cerr<<"Version compiled without MEDCoupling"<<finl;
+  Process::exit();
+  throw;
+}
 #endif
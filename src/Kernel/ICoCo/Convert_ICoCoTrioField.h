@@ -37,10 +37,12 @@ void affecte_int_avec_inttab(int** p, const ArrOfInt& trio);
 void build_triofield(const Champ_Generique_base&, ICoCo::TrioField& );
 void build_triofield(const Champ_base&, const Domaine_dis_base& , ICoCo::TrioField& );
 void build_triomesh(const Domaine_dis_base& , ICoCo::TrioField& , int, int);
+bool update_triofield_values(const Champ_Generique_base&, ICoCo::TrioField& );
 
 #ifndef NO_MEDFIELD
 ICoCo::MEDDoubleField build_medfield(ICoCo::TrioField&);
 ICoCo::MEDDoubleField build_medfield(const Champ_Generique_base&);
+bool update_medfield_values(const Champ_Generique_base&, ICoCo::MEDDoubleField&);
 #endif
 
 #endif /* Convert_ICoCoTrioField_included */
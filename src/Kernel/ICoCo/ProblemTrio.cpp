@@ -41,6 +41,7 @@
 #include <stat_counters.h>
 #include <Field_base.h>
 
+#include <Champ_Generique_base.h>
 #include <Champ_Inc.h>
 #include <Equation_base.h>
 
@@ -516,10 +517,15 @@ void ProblemTrio::getOutputField(const std::string& name_, TrioField& afield) co
   pb->getOutputField(name,afield);
 }
 
-// TODO: provide a more efficient version of this:
+/*! @brief Update the values of a field previously obtained by getOutputField.
+ *
+ * The mesh of afield is kept and the values are copied into its existing buffer:
+ *  no mesh rebuild and no allocation per coupling iteration.
+ */
 void ProblemTrio::updateOutputField(const std::string& name, TrioField& afield) const
 {
-  getOutputField(name, afield);
+  const Nom nom(name);
+  pb->updateOutputField(nom, afield);
 }
 
 void ProblemTrio::getOutputMEDDoubleField(const std::string& name,MEDDoubleField& medfield) const
@@ -548,14 +554,24 @@ void ProblemTrio::getInputMEDDoubleFieldTemplate(const std::string& name, MEDDou
 void ProblemTrio::setInputMEDDoubleField(const std::string& name, const MEDDoubleField& afield)
 {
 #ifndef NO_MEDFIELD
-  // bof en attendant mieux
+  // Seule l'entete du TrioField est utile a setInputField (pas de maillage) :
+  // on evite ainsi de reconstruire le maillage du template a chaque appel.
   TrioField  triofield;
-  getInputFieldTemplate(name,triofield);
 #ifdef OLD_MEDCOUPLING
-  const ParaMEDMEM::DataArrayDouble *fieldArr=afield.getField()->getArray();
+  const ParaMEDMEM::MEDCouplingFieldDouble *mcfield=afield.getField();
+  const ParaMEDMEM::DataArrayDouble *fieldArr=mcfield->getArray();
+  const bool on_cells = mcfield->getTypeOfField() == ParaMEDMEM::ON_CELLS;
 #else
-  const MEDCoupling::DataArrayDouble *fieldArr=afield.getMCField()->getArray();
+  const MEDCoupling::MEDCouplingFieldDouble *mcfield=afield.getMCField();
+  const MEDCoupling::DataArrayDouble *fieldArr=mcfield->getArray();
+  const bool on_cells = mcfield->getTypeOfField() == MEDCoupling::ON_CELLS;
 #endif
+  triofield.setName(name);
+  triofield._time1=pb->presentTime();
+  triofield._time2=pb->futureTime();
+  triofield._type = on_cells ? 0 : 1;
+  triofield._nb_elems = triofield._nbnodes = (int)fieldArr->getNumberOfTuples();
+  triofield._nb_field_components = (int)fieldArr->getNumberOfComponents();
   triofield._field=const_cast<double*> (fieldArr->getConstPointer());
   // il faut copier les valeurs
   setInputField(name,triofield);
@@ -578,10 +594,17 @@ void ProblemTrio::setInputMEDDoubleField(const std::string& name, const MEDDoubl
 #endif
 }
 
-// TODO TODO FIXME do this more cleverly
+/*! @brief Update the values of a MED field previously obtained by getOutputMEDDoubleField.
+ *
+ * The MEDCoupling mesh is kept, the values are written in place into the field array,
+ *  which is then declared as modified. The field is rebuilt only if it does not match.
+ */
 void ProblemTrio::updateOutputMEDDoubleField(const std::string& name, MEDDoubleField& medfield) const
 {
 #ifndef NO_MEDFIELD
+  REF(Champ_Generique_base) ref_ch = pb->findOutputField(Nom(name));
+  if (ref_ch.non_nul() && medfield.getName() == name && update_medfield_values(ref_ch.valeur(), medfield))
+    return;
   TrioField  triofield;
   getOutputField(name,triofield);
   medfield= build_medfield(triofield);
@@ -15,6 +15,7 @@
 
 #include <Champ_Fonc_MED_Table_Temps.h>
 #include <Lecture_Table.h>
+#include <Device.h>
 #include <EChaine.h>
 #include <Param.h>
 #ifdef MEDCOUPLING_
@@ -157,11 +158,24 @@ void Champ_Fonc_MED_Table_Temps::lire(double t, int given_it)
         frac_ = frac;
       else if (frac!=frac_)
         set_instationnaire(true); // table non constante
-      const DoubleTab& vals0 = le_champ0().valeurs();
-      DoubleTab& vals = le_champ().valeurs();
-
-      vals = vals0;
-      vals *= frac;
+      // Le champ lu est garde en memoire : on ne recalcule que si le coefficient change, en un seul passage
+      if (frac != frac_calcule_)
+        {
+          const DoubleTab& vals0 = le_champ0().valeurs();
+          DoubleTab& vals = le_champ().valeurs();
+          const int nb_items = vals.dimension_tot(0), nb_comp = vals.line_size();
+          CDoubleTabView v0 = vals0.view_ro();
+          DoubleTabView v = vals.view_wo();
+          auto kern = KOKKOS_LAMBDA(int i)
+          {
+            for (int c = 0; c < nb_comp; c++)
+              v(i, c) = frac * v0(i, c);
+          };
+          start_gpu_timer();
+          Kokkos::parallel_for("[KOKKOS] Champ_Fonc_MED_Table_Temps::lire", nb_items, kern);
+          end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Champ_Fonc_MED_Table_Temps::lire");
+          frac_calcule_ = frac;
+        }
     }
   Champ_Fonc_base::mettre_a_jour(t);
   le_champ().Champ_Fonc_base::mettre_a_jour(t);
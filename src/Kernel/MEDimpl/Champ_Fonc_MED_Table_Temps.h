@@ -43,6 +43,7 @@ protected :
   Champ_Fonc vrai_champ0_;
   bool table_lue_ = false;
   double frac_=DMAXFLOAT;
+  double frac_calcule_=DMAXFLOAT; // coefficient avec lequel les valeurs courantes ont ete calculees
 };
 
 #endif /* Champ_Fonc_MED_Table_Temps_included */
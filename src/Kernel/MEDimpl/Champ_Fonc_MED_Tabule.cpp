@@ -14,6 +14,8 @@
 *****************************************************************************/
 
 #include <Champ_Fonc_MED_Tabule.h>
+#include <Device.h>
+#include <algorithm>
 
 Implemente_instanciable( Champ_Fonc_MED_Tabule, "Champ_Fonc_MED_Tabule", Champ_Fonc_MED );
 // XD Champ_Fonc_MED_Tabule champ_fonc_med Champ_Fonc_MED_Tabule -1 not_set
@@ -29,64 +31,83 @@ Entree& Champ_Fonc_MED_Tabule::readOn(Entree& is)
   return is;
 }
 
-void Champ_Fonc_MED_Tabule::mettre_a_jour(double le_temps)
+/*! @brief Met dans tab1_ et tab2_ les tranches d'indices i1 et i2 de temps_sauv_ en lisant le moins possible le fichier MED :
+ *
+ *   une tranche deja en memoire est reutilisee (en particulier tab2_ devient tab1_ quand on passe a l'intervalle suivant).
+ *
+ */
+void Champ_Fonc_MED_Tabule::charger_tranches(int i1, int i2)
 {
-
-  // temps1_ temps2_ tel que temps [temps1_ , temps2_[
-  if (est_egal(le_temps, temps_calc_))
+  if (i1 == indice1_ && i2 == indice2_)
     return;
 
-  if ((temps2_ < -1e8) || (le_temps <= temps_calc_))
+  if (i1 == indice2_)
+    {
+      // On avance d'un intervalle : la tranche de fin devient la tranche de debut
+      std::swap(tab1_, tab2_);
+      std::swap(indice1_, indice2_);
+    }
+  else if (i1 != indice1_)
     {
-      // initialisation   de -1e9 a T[0] on met la meme chose
-      lire(temps_sauv_[0]);
+      lire(temps_sauv_[i1]);
       tab1_ = valeurs();
-      tab2_ = valeurs();
-      temps2_ = temps_sauv_[0];
+      indice1_ = i1;
     }
-  if (le_temps >= temps2_)
+
+  if (i2 == indice1_)
+    tab2_ = tab1_;
+  else if (i2 != indice2_)
     {
-      int i, nbt = temps_sauv_.size_array();
-      int trouve = 0;
-      for (i = 0; i < nbt - 1; i++)
-        {
-          if ((le_temps >= temps_sauv_[i]) && (le_temps <= temps_sauv_[i + 1]))
-            {
-              trouve = 1;
-              temps1_ = temps_sauv_[i];
-              lire(temps1_);
-              tab1_ = valeurs();
-              temps2_ = temps_sauv_[i + 1];
-              lire(temps2_);
-              tab2_ = valeurs();
-            }
-        }
-      if (trouve == 0)
-        {
-          temps1_ = temps_sauv_[nbt - 1];
-          assert(le_temps >= temps_sauv_[nbt - 1]);
-          lire(temps1_);
-          tab1_ = valeurs();
-          tab2_ = tab1_;
-          temps2_ = DMAXFLOAT;
-        }
-      else
-        set_instationnaire(true);
+      lire(temps_sauv_[i2]);
+      tab2_ = valeurs();
     }
+  indice2_ = i2;
+}
 
-  if ((le_temps >= temps1_) && (le_temps < temps2_))
+void Champ_Fonc_MED_Tabule::mettre_a_jour(double le_temps)
+{
+  if (est_egal(le_temps, temps_calc_))
+    return;
+
+  // Recherche de l'intervalle [temps_sauv_[i], temps_sauv_[i+1][ contenant le_temps.
+  // Avant le premier temps et apres le dernier, le champ est constant.
+  const int nbt = temps_sauv_.size_array();
+  const double *t_deb = temps_sauv_.addr();
+  const int i = (int) (std::upper_bound(t_deb, t_deb + nbt, le_temps) - t_deb) - 1;
+  if (i < 0)
+    {
+      charger_tranches(0, 0);
+      temps1_ = -1e9;
+      temps2_ = temps_sauv_[0];
+    }
+  else if (i >= nbt - 1)
     {
-      valeurs() = tab2_;
-      valeurs() -= tab1_;
-      valeurs() *= (le_temps - temps1_) / (temps2_ - temps1_);
-      valeurs() += tab1_;
-      temps_calc_ = le_temps;
-      //  Cerr<<temps_calc_<<" YYYYYY "<<valeurs()[0]<<" "<< tab2_[0]<< " "<<tab1_[0]<<finl;
+      charger_tranches(nbt - 1, nbt - 1);
+      temps1_ = temps_sauv_[nbt - 1];
+      temps2_ = DMAXFLOAT;
     }
   else
     {
-      Cerr << "internal error" << finl;
-      exit();
+      charger_tranches(i, i + 1);
+      temps1_ = temps_sauv_[i];
+      temps2_ = temps_sauv_[i + 1];
+      set_instationnaire(true);
     }
 
+  // Interpolation en memoire en un seul passage: v = t1 + a * (t2 - t1)
+  const double a = (indice1_ == indice2_) ? 0. : (le_temps - temps1_) / (temps2_ - temps1_);
+  DoubleTab& vals = valeurs();
+  const int nb_items = vals.dimension_tot(0), nb_comp = vals.line_size();
+  CDoubleTabView t1 = tab1_.view_ro();
+  CDoubleTabView t2 = tab2_.view_ro();
+  DoubleTabView v = vals.view_wo();
+  auto kern = KOKKOS_LAMBDA(int k)
+  {
+    for (int c = 0; c < nb_comp; c++)
+      v(k, c) = t1(k, c) + a * (t2(k, c) - t1(k, c));
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Champ_Fonc_MED_Tabule::mettre_a_jour", nb_items, kern);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Champ_Fonc_MED_Tabule::mettre_a_jour");
+  temps_calc_ = le_temps;
 }
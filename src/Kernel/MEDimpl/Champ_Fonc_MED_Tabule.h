@@ -19,6 +19,10 @@
 #include <Champ_Fonc_MED.h>
 
 /*! @brief : class Champ_Fonc_MED_Tabule
+ *
+ *  Champ lu a plusieurs temps d'un fichier MED et interpole lineairement en temps.
+ *  Les deux tranches encadrant le temps courant sont gardees en memoire (tab1_, tab2_) : quand le temps
+ *  franchit une entree de la table, la tranche deja lue est reutilisee et seule la suivante est lue.
  *
  */
 class Champ_Fonc_MED_Tabule : public Champ_Fonc_MED
@@ -28,7 +32,11 @@ public :
   void mettre_a_jour(double temps) override;
 
 protected:
+  void charger_tranches(int i1, int i2);
+
   DoubleTab tab1_, tab2_;
+  // Indices dans temps_sauv_ des tranches stockees dans tab1_ et tab2_ (-1 si rien n'est lu)
+  int indice1_ = -1, indice2_ = -1;
   double temps1_ = -1e9, temps2_ = -1e9, temps_calc_ = -2e9;
 };
 
@@ -53,7 +53,7 @@ public:
   virtual void process_recv_data(const Echange_EV_Options& opt, Schema_Comm_Vecteurs&, IntVect&) const = 0;
   virtual const ArrOfInt& get_items_to_compute() const = 0;
   virtual const ArrOfInt& get_items_to_sum() const = 0;
-  virtual int nb_items_seq_tot() const = 0;
+  virtual trustIdType nb_items_seq_tot() const = 0;
   virtual int nb_items_seq_local() const = 0;
 
 private:
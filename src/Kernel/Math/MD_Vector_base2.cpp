@@ -33,14 +33,17 @@ MD_Vector_base2::MD_Vector_base2()
  */
 Entree& MD_Vector_base2::readOn(Entree& is)
 {
+  // Param ne lit pas d'entier 64 bits : nb_items_seq_tot est lu comme un Nom puis converti en trustIdType
+  Nom nb_items_seq_tot("-1");
   Param p("MD_Vector_base2");
   p.ajouter("nb_items_tot", &nb_items_tot_);
   p.ajouter("nb_items_reels", &nb_items_reels_);
-  p.ajouter("nb_items_seq_tot", &nb_items_seq_tot_);
+  p.ajouter("nb_items_seq_tot", &nb_items_seq_tot);
   p.ajouter("nb_items_seq_local", &nb_items_seq_local_);
   p.ajouter("blocs_items_to_sum", &blocs_items_to_sum_);
   p.ajouter("blocs_items_to_compute", &blocs_items_to_compute_);
   p.lire_avec_accolades(is);
+  convert_to(nb_items_seq_tot.getChar(), nb_items_seq_tot_);
   return is;
 }
 
@@ -28,7 +28,7 @@ public:
   int get_nb_items_tot() const override { return nb_items_tot_; }
   const ArrOfInt& get_items_to_compute() const override { return blocs_items_to_compute_; }
   const ArrOfInt& get_items_to_sum() const override { return blocs_items_to_sum_; }
-  int nb_items_seq_tot() const override { return nb_items_seq_tot_; }
+  trustIdType nb_items_seq_tot() const override { return nb_items_seq_tot_; }
   int nb_items_seq_local() const override { return nb_items_seq_local_; }
 
   static inline void append_item_to_blocs(ArrOfInt& blocs, int item);
@@ -42,8 +42,8 @@ public:
   //  (cas des tableaux P1Bulle multilocalisation pour lesquels les items reels et virtuels sont melanges)
   int   nb_items_reels_;
 
-  // Nombre total (sur tous les procs) d'items sequentiels (c'est mp_sum(nb_items_seq_local_))
-  int   nb_items_seq_tot_;
+  // Nombre total (sur tous les procs) d'items sequentiels (c'est mp_sum_as_long(nb_items_seq_local_)), sur 64 bits
+  trustIdType nb_items_seq_tot_;
   // Nombre d'items sequentiels sur ce processeur (c'est le nombre d'items dans les blocs de blocs_items_to_sum_)
   int   nb_items_seq_local_;
 
@@ -162,7 +162,7 @@ MD_Vector_std::MD_Vector_std(int nb_items_tot, int nb_items_reels, const ArrOfIn
       }
     blocs_items_to_sum_ = blocs;
     nb_items_seq_local_ = nb_seq;
-    nb_items_seq_tot_ = mp_sum(nb_seq);
+    nb_items_seq_tot_ = mp_sum_as_long(nb_seq);
   }
 
   // Bloc items to compute:
@@ -336,7 +336,7 @@ static void creer_md_vect_renum(const IntVect& renum, const MD_Vector_std& src,
   // et blocs_items_to_compute_ du descripteur source.
   extract_blocs(src.blocs_items_to_sum_, renum, dest.blocs_items_to_sum_);
   dest.nb_items_seq_local_ = extract_blocs(src.blocs_items_to_compute_, renum, dest.blocs_items_to_compute_);
-  dest.nb_items_seq_tot_ = Process::mp_sum(dest.nb_items_seq_local_);
+  dest.nb_items_seq_tot_ = Process::mp_sum_as_long(dest.nb_items_seq_local_);
 
   // ********************************************************
   // Calcul des items a recevoir: ce sont les items pour lesquels renum[i] >= 0 et qui etaient a
@@ -127,6 +127,12 @@ public :
   inline double coef(int i, int j) const { return operator()(i,j); }
   inline double& coef(int i,int j) { return operator()(i,j); }
 
+  // Assemblage en deux phases : indice(i,j) donne la place de M(i,j) dans coeff_ (-1 si M(i,j) n'est pas dans le stencil),
+  // a enregistrer lors de la phase symbolique ; lors de la phase numerique, indice_designe(k,i,j) verifie en O(1) que
+  // la place enregistree designe toujours M(i,j) avant d'ecrire directement dans coeff_[k] (cf Iterateur_VDF_Elem).
+  inline int indice(int i, int j) const;
+  inline bool indice_designe(int k, int i, int j) const;
+
   Matrice_Morse& operator=(const Matrice_Morse& );
   friend Matrice_Morse operator +(const Matrice_Morse&, const Matrice_Morse& );
   Matrice_Morse& operator +=(const Matrice_Morse& );
@@ -205,7 +211,7 @@ private :
 
 int Matrice_Morse_test();
 
-inline double Matrice_Morse::operator()(int i, int j) const
+inline int Matrice_Morse::indice(int i, int j) const
 {
   assert( (symetrique_==0 && que_suis_je()=="Matrice_Morse")
           || (symetrique_==1 && que_suis_je()=="Matrice_Morse_Sym")
@@ -217,33 +223,31 @@ inline double Matrice_Morse::operator()(int i, int j) const
     {
       int k = (int) (std::lower_bound(tab2_.addr() + k1, tab2_.addr() + k2, j + 1) - tab2_.addr());
       if (k < k2 && tab2_[k] == j + 1)
-        return coeff_[k];
+        return k;
     }
   else
     for (int k=k1; k<k2; k++)
-      if (tab2_[k]-1 == j) return(coeff_[k]);
+      if (tab2_[k]-1 == j) return k;
+  return -1;
+}
+
+inline bool Matrice_Morse::indice_designe(int k, int i, int j) const
+{
+  if ((symetrique_==1) && ((j-i)<0)) std::swap(i,j);
+  return k >= tab1_[i] - 1 && k < tab1_[i + 1] - 1 && tab2_[k] == j + 1;
+}
+
+inline double Matrice_Morse::operator()(int i, int j) const
+{
+  const int k = indice(i, j);
   // Si coefficient non trouve c'est qu'il est nul:
-  return(0);
+  return k < 0 ? 0 : coeff_[k];
 }
 
 inline double& Matrice_Morse::operator()(int i, int j)
 {
-  assert( (symetrique_==0 && que_suis_je()=="Matrice_Morse")
-          || (symetrique_==1 && que_suis_je()=="Matrice_Morse_Sym")
-          || (symetrique_==2 && que_suis_je()=="Matrice_Morse_Diag") );
-  //if (symetrique_==1 && j<i) std::swap(i,j); // Do not use, possible error during compile: "signed overflow does not occur when assuming that (X + c) < X is always false"
-  if ((symetrique_==1) && ((j-i)<0)) std::swap(i,j);
-  int k1=tab1_[i]-1;
-  int k2=tab1_[i+1]-1;
-  if (sorted_)
-    {
-      int k = (int) (std::lower_bound(tab2_.addr() + k1, tab2_.addr() + k2, j + 1) - tab2_.addr());
-      if (k < k2 && tab2_[k] == j + 1)
-        return coeff_[k];
-    }
-  else
-    for (int k=k1; k<k2; k++)
-      if (tab2_[k]-1 == j) return(coeff_[k]);
+  const int k = indice(i, j);
+  if (k >= 0) return coeff_[k];
   if (symetrique_==2) return zero_; // Pour Matrice_Morse_Diag, on ne verifie pas si la case est definie et l'on renvoie 0
 #ifndef NDEBUG
   // Uniquement en debug afin de permettre l'inline en optimise
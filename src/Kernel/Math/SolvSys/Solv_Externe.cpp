@@ -17,6 +17,7 @@
 #include <Matrice_Base.h>
 #include <Matrice_Morse_Sym.h>
 #include <Matrice_Bloc_Sym.h>
+#include <climits>
 
 Implemente_base_sans_constructeur_ni_destructeur(Solv_Externe,"Solv_Externe",SolveurSys_base);
 
@@ -41,8 +42,15 @@ void Solv_Externe::construit_renum(const DoubleVect& b)
   // Compute important value:
   secmem_sz_ = b.size_totale();
   nb_rows_ = nb_items_to_keep_;
-  nb_rows_tot_ = mp_sum(nb_rows_);
-  decalage_local_global_ = mppartial_sum(nb_rows_);
+  // Total et decalage calcules sur 64 bits ; la numerotation globale (renum_) etant un IntTab, elle doit tenir sur un int
+  const trustIdType nb_rows_tot_long = Process::mp_sum_as_long(nb_rows_);
+  if (nb_rows_tot_long > INT_MAX)
+    {
+      Cerr << "Error in Solv_Externe::construit_renum : " << nb_rows_tot_long << " global rows exceed the capacity of an int (" << INT_MAX << ")." << finl;
+      Process::exit();
+    }
+  nb_rows_tot_ = (int) nb_rows_tot_long;
+  decalage_local_global_ = (int) Process::mppartial_sum_as_long(nb_rows_);
   //Journal()<<"nb_rows_=" << nb_rows_ << " nb_rows_tot_=" << nb_rows_tot_ << " decalage_local_global_=" << decalage_local_global_ << finl;
 
   /**********************/
@@ -21,7 +21,9 @@
 #include <MD_Vector_base.h>
 #include <MD_Vector_tools.h>
 #include <communications.h>
+#include <Reductions_Differees.h>
 #include <TRUSTTab_parts.h>
+#include <climits>
 
 Implemente_instanciable_sans_constructeur(Solv_GCP,"Solv_GCP",solv_iteratif);
 //
@@ -400,10 +402,11 @@ int Solv_GCP::resoudre_(const Matrice_Base& matrice,
 {
   const int n_items_reels = solution.size_reelle_ok() ? solution.size_reelle() : solution.size_totale();
   {
-    const int nb_items_seq = solution.get_md_vector().valeur().nb_items_seq_tot();
+    const trustIdType nb_items_seq = solution.get_md_vector().valeur().nb_items_seq_tot();
     const int ls = secmem.line_size();
-    const int nb_inco_tot = nb_items_seq * ls;
-    nmax = std::max(nb_inco_tot, nmax);
+    const trustIdType nb_inco_tot = nb_items_seq * ls;
+    // nombre maximal d'iterations : au moins le nombre d'inconnues, borne a INT_MAX
+    nmax = (int) std::min(std::max(nb_inco_tot, (trustIdType) nmax), (trustIdType) INT_MAX);
   }
 
   const int avec_precond = le_precond_.non_nul();
@@ -461,12 +464,20 @@ int Solv_GCP::resoudre_(const Matrice_Base& matrice,
     {
       tmp_p_.inject_array(residu_, n_items_reels);
     }
-  double dold = mp_prodscal(residu_, tmp_p_);
+  // (residu, p) et |residu|^2 en un seul passage sur residu, puis une seule reduction parallele avec |b|^2
+  const DoubleVect *vy[2] = { &tmp_p_, &residu_ };
+  double prodscal_local[2];
+  local_prodscal_multiple(residu_, 2, vy, prodscal_local);
+  Reductions_Differees reductions;
+  const int i_dold = reductions.ajouter(prodscal_local[0], Comm_Group::COLL_SUM), i_norme = reductions.ajouter(prodscal_local[1], Comm_Group::COLL_SUM),
+            i_norme_b = reductions.ajouter(local_carre_norme_vect(resu_), Comm_Group::COLL_SUM);
+  reductions.reduire();
+  double dold = reductions.valeur(i_dold);
 
   operator_negate(tmp_p_, VECT_REAL_ITEMS);
 
-  double norme = mp_norme_vect(residu_);
-  double norme_b = mp_norme_vect(resu_);
+  double norme = sqrt(reductions.valeur(i_norme));
+  double norme_b = sqrt(reductions.valeur(i_norme_b));
 
   if (limpr()==1)
     {
@@ -505,8 +516,8 @@ int Solv_GCP::resoudre_(const Matrice_Base& matrice,
         }
       else
         {
-          ajoute_alpha_v(residu_, alfa, resu_);
-          norme_residu_locale = local_carre_norme_vect(residu_);
+          // residu += alfa * resu et carre de la norme locale du nouveau residu en un seul passage
+          norme_residu_locale = ajoute_alpha_v_prodscal(residu_, alfa, resu_, residu_);
         }
 
       if(avec_precond)
@@ -528,8 +539,9 @@ int Solv_GCP::resoudre_(const Matrice_Base& matrice,
         }
       else
         {
-          const double dnew = mp_carre_norme_vect(residu_);
+          // Sans preconditionnement, (residu, z) = |residu|^2 : une seule somme parallele
           norme = mp_sum(norme_residu_locale);
+          const double dnew = norme;
           assert(dnew >= 0);
           multiply_sub(tmp_p_, residu_, dnew / dold);
           dold = dnew;
@@ -204,10 +204,10 @@ int gmres_local( const Matrice_Morse& A, const DoubleVect& b,DoubleVect& x1,doub
   v1 = 0. ;
 
   A.multvect_(x1,v0);
-  v0 *= -1. ;
-  v0+=b;
+  // v0 = b - A x1 et sa norme en un seul passage memoire
+  double res0 = multiplie_ajoute_v_carre_norme(v0, -1., b, VECT_ALL_ITEMS);
   v0.echange_espace_virtuel();
-  double res0 = mp_norme_vect(v0);
+  res0 = sqrt(Process::mp_sum(res0));
   for (ii=0; ii<ns2; ii++)
     v0(ii)*=Diag(ii);
   res = mp_norme_vect(v0);
@@ -244,14 +244,16 @@ int gmres_local( const Matrice_Morse& A, const DoubleVect& b,DoubleVect& x1,doub
           v0 = v1 ;
           // Modifie par DJ
           //---------------
+          // Gram-Schmidt modifie: la mise a jour de v0 par v[i] et le produit scalaire local avec v[i+1]
+          // (ou le carre de la norme apres le dernier vecteur) sont faits en un seul passage memoire.
+          // L'espace virtuel de v0 n'est pas utilise ici, il est echange avant le prochain produit matrice-vecteur.
+          double prodscal_local = local_prodscal(v0,v[0]);
           for(i=0; i<=j; i++)
             {
-              DoubleVect& vvi=v[i];
-              h(i,j)+=mp_prodscal(v0,vvi);
-              for (ii=0; ii<ns; ii++) v0(ii) -= h(i,j) * vvi(ii);
-              v0.echange_espace_virtuel();
+              h(i,j)+=Process::mp_sum(prodscal_local);
+              prodscal_local = ajoute_alpha_v_prodscal(v0, -h(i,j), v[i], i<j ? v[i+1] : v0);
             }
-          tem=mp_norme_vect(v0);
+          tem=sqrt(Process::mp_sum(prodscal_local));
 
           h(j+1,j) = tem;
           if(tem<rec_min)
@@ -286,18 +288,19 @@ l5:
           for(i0=i-1; i0>=0; i0--)
             r[i0] -= h(i0,i)* r[i];
         }
-      for(i=0; i<nk; i++)
+      // x1 += sum r[i] v[i] par paquets de NB_MAX_COMBINAISON_LINEAIRE vecteurs de Krylov par passage memoire
+      for(i=0; i<nk; i+=NB_MAX_COMBINAISON_LINEAIRE)
         {
-          DoubleVect& vvi=v[i];
-          for(ii=0; ii<ns; ii++)  x1(ii) += r[i]*vvi(ii);
+          const int nb = std::min(NB_MAX_COMBINAISON_LINEAIRE, nk-i);
+          const DoubleVect *vx[NB_MAX_COMBINAISON_LINEAIRE];
+          for (i0=0; i0<nb; i0++) vx[i0] = &v[i+i0];
+          combinaison_lineaire(x1, 1., x1, nb, r.addr()+i, vx, VECT_REAL_ITEMS);
         }
       x1.echange_espace_virtuel();
       A.multvect_(x1,v0);
-      v0 *= -1. ;
-      v0+=b;
 
-      // calcul du residu sans le precond....
-      double res2=mp_norme_vect(v0);
+      // calcul du residu sans le precond.... (v0 = b - A x1 et sa norme en un seul passage)
+      double res2=sqrt(Process::mp_sum(multiplie_ajoute_v_carre_norme(v0, -1., b, VECT_ALL_ITEMS)));
       if ((it>0) && (controle_residu==1) && (sup_strict(res2,res2_old)))
         {
           Cout << "The Gmres iterative system is stopped after : " << it+1 <<" iterations "<<finl;
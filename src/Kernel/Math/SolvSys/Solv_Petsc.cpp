@@ -2913,6 +2913,8 @@ bool Solv_Petsc::check_stencil(const Matrice_Morse& mat_morse)
   int new_stencil=0;
   if (rebuild_matrix_ || read_matrix_ || !mataij_)
     new_stencil = 1;
+  else if (same_stencil())
+    new_stencil = 0; // The assembler guarantees that only the coefficients have changed
   else
     {
       PetscBool done;
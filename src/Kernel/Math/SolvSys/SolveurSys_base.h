@@ -63,12 +63,16 @@ public :
   // Methods to set/get reuse_preconditioner_
   void set_reuse_preconditioner(bool flag) { reuse_preconditioner_=flag; }
   bool reuse_preconditioner() { return reuse_preconditioner_; }
+  // Methods to set/get same_stencil_ (set by an assembler when only the matrix coefficients changed since the last matrix)
+  virtual void set_same_stencil(bool flag) { same_stencil_=flag; }
+  bool same_stencil() const { return same_stencil_; }
   const Nom& get_chaine_lue() const { return chaine_lue_ ; };
 
 protected :
   int nouvelle_matrice_; // Drapeau pour savoir si un stockage ou une factorisation est a refaire
   int save_matrice_;     // Drapeau pour savoir si un stockage disque est a refaire
   int return_on_error_ = 0; //drapeau pour savoir si on doit faire exit() ou renvoyer -1 si resoudre_
+  bool same_stencil_ = false; // Flag to know if the matrix stencil is unchanged (symbolic setup can be reused)
 
   // Pour lecture/stockage des parametres des solveurs:
   Nom chaine_lue_;
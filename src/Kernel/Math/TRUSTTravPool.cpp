@@ -16,6 +16,7 @@
 #include <TRUSTTravPool.h>
 #include <TRUSTArray.h>
 #include <unordered_map>
+#include <mutex>
 #include <list>
 #include <iostream>
 #include <cassert>
@@ -41,6 +42,11 @@ struct PoolImpl_
   */
   static pool_t Free_blocks_;
 
+  /*! Protects Free_blocks_ (and the debug counters) in hybrid MPI+threads mode, where Trav arrays may be created
+   *  and destroyed concurrently by several host threads of the same process. Uncontended in pure MPI mode.
+   */
+  static std::mutex Mutex_;
+
 #ifndef NDEBUG
   //! Total allocation requests:
   static size_t req_sz_;
@@ -58,6 +64,10 @@ template<> PoolImpl_<int>::pool_t    PoolImpl_<int>::Free_blocks_    = PoolImpl_
 template<> PoolImpl_<float>::pool_t  PoolImpl_<float>::Free_blocks_  = PoolImpl_<float>::pool_t();
 template<> PoolImpl_<double>::pool_t PoolImpl_<double>::Free_blocks_ = PoolImpl_<double>::pool_t();
 
+template<> std::mutex PoolImpl_<int>::Mutex_ {};
+template<> std::mutex PoolImpl_<float>::Mutex_ {};
+template<> std::mutex PoolImpl_<double>::Mutex_ {};
+
 #ifndef NDEBUG
 // Need C++17 to have this inline in the class def directly ...
 template<> size_t PoolImpl_<int>::req_sz_ = 0;
@@ -106,29 +116,31 @@ typename TRUSTTravPool<_TYPE_>::block_ptr_t TRUSTTravPool<_TYPE_>::GetFreeBlock(
   using ptr_t = typename PoolImpl_<_TYPE_>::ptr_t;
   using lst_t = typename PoolImpl_<_TYPE_>::list_t;
 
+  {
+    std::lock_guard<std::mutex> lock(PoolImpl_<_TYPE_>::Mutex_);
 #ifndef NDEBUG
-  PoolImpl_<_TYPE_>::req_sz_ += sz;
+    PoolImpl_<_TYPE_>::req_sz_ += sz;
 #endif
 
-  lst_t& lst = GetOrCreateList<_TYPE_>(sz);
-  // Is there an available block?
-  if (lst.size())
-    {
-      // Yes - pop it from the list and returns it:
-      ptr_t ret = lst.back();
-      lst.pop_back();
+    lst_t& lst = GetOrCreateList<_TYPE_>(sz);
+    // Is there an available block?
+    if (lst.size())
+      {
+        // Yes - pop it from the list and returns it:
+        ptr_t ret = lst.back();
+        lst.pop_back();
 #ifndef NDEBUG
-      PoolImpl_<_TYPE_>::num_items_--;
+        PoolImpl_<_TYPE_>::num_items_--;
 #endif
-      return ret;
-    }
-  else // No, must create a new one - it will be registered in the pool when released in ~TRUSTArray()
-    {
+        return ret;
+      }
 #ifndef NDEBUG
-      PoolImpl_<_TYPE_>::actual_sz_ += sz;
+    PoolImpl_<_TYPE_>::actual_sz_ += sz;
 #endif
-      return std::make_shared<vec_t>(vec_t(sz));
-    }
+  }
+  // No, must create a new one - it will be registered in the pool when released in ~TRUSTArray()
+  // (allocation done outside of the lock)
+  return std::make_shared<vec_t>(vec_t(sz));
 }
 
 /*! "Resize" a temporary Trav block - two possible strategies:
@@ -187,6 +199,7 @@ void TRUSTTravPool<_TYPE_>::ReleaseBlock(typename TRUSTTravPool<_TYPE_>::block_p
 
   if (sz)
     {
+      std::lock_guard<std::mutex> lock(PoolImpl_<_TYPE_>::Mutex_);
       lst_t& lst = GetOrCreateList<_TYPE_>(sz);
       // Append the free block pointer to the list corresponding to its size:
       lst.push_back(p);
@@ -15,6 +15,7 @@
 
 #include <TRUSTVect.h>
 #include <TRUSTVect_tools.tpp>
+#include <vector>
 
 // Ajout d'un flag par appel a end_timer peut etre couteux (creation d'une string)
 #ifdef _OPENMP
@@ -97,6 +98,171 @@ template void ajoute_operation_speciale_generic<TYPE_OPERATION_VECT_SPEC::ADD_,
 template void ajoute_operation_speciale_generic<TYPE_OPERATION_VECT_SPEC::CARRE_, double>(TRUSTVect<double>& resu, double alpha, const TRUSTVect<double>& vx, Mp_vect_options opt);
 template void ajoute_operation_speciale_generic<TYPE_OPERATION_VECT_SPEC::CARRE_, float>(TRUSTVect<float>& resu, float alpha, const TRUSTVect<float>& vx, Mp_vect_options opt);
 
+// Decoupe les blocs d'items a mettre a jour (opt) en sous-blocs { debut, fin, a_sommer } selon qu'ils appartiennent
+// ou non aux items sequentiels (ceux qui entrent dans les sommes paralleles). Indices en nombre de lignes.
+static void blocs_mise_a_jour_et_somme(const MD_Vector& md, const int nb_lignes_tot, Mp_vect_options opt, std::vector<int>& sous_blocs)
+{
+  sous_blocs.clear();
+#ifndef LATATOOLS
+  if (md.non_nul() && Process::is_parallel())
+    {
+      const TRUSTArray<int>& blocs_somme = md.valeur().get_items_to_sum();
+      const int nb_somme = blocs_somme.size_array() >> 1;
+      ArrOfInt bloc_tous(2);
+      bloc_tous[0] = 0, bloc_tous[1] = nb_lignes_tot;
+      const TRUSTArray<int>& blocs_maj = (opt == VECT_ALL_ITEMS) ? bloc_tous : (opt == VECT_SEQUENTIAL_ITEMS) ? blocs_somme : md.valeur().get_items_to_compute();
+      const int nb_maj = blocs_maj.size_array() >> 1;
+      int k = 0;
+      for (int b = 0; b < nb_maj; b++)
+        {
+          int pos = blocs_maj[2 * b];
+          const int fin = blocs_maj[2 * b + 1];
+          while (pos < fin)
+            {
+              while (k < nb_somme && blocs_somme[2 * k + 1] <= pos) k++;
+              if (k < nb_somme && blocs_somme[2 * k] < fin)
+                {
+                  const int deb_somme = std::max(pos, blocs_somme[2 * k]), fin_somme = std::min(fin, blocs_somme[2 * k + 1]);
+                  if (deb_somme > pos) sous_blocs.push_back(pos), sous_blocs.push_back(deb_somme), sous_blocs.push_back(0);
+                  sous_blocs.push_back(deb_somme), sous_blocs.push_back(fin_somme), sous_blocs.push_back(1);
+                  pos = fin_somme;
+                }
+              else
+                {
+                  sous_blocs.push_back(pos), sous_blocs.push_back(fin), sous_blocs.push_back(0);
+                  pos = fin;
+                }
+            }
+        }
+    }
+  else
+#endif
+    if (nb_lignes_tot > 0)
+      sous_blocs.push_back(0), sous_blocs.push_back(nb_lignes_tot), sous_blocs.push_back(1);
+}
+
+// Somme sur l'hote des f(i, s) pour i dans [debut, fin), s etant un tableau de nb_sommes sommes partielles.
+// L'intervalle est decoupe en tranches de taille fixe traitees en parallele par le backend hote de Kokkos (option -threads),
+// puis les sommes partielles sont ajoutees dans l'ordre des tranches : le resultat ne depend pas du nombre de threads.
+template <typename _TYPE_, typename _FONCTION_>
+static void somme_hote_par_tranches(const int debut, const int fin, const int nb_sommes, const _FONCTION_& f, _TYPE_ *sommes)
+{
+  static constexpr int TAILLE_TRANCHE = 8192;
+  const int nb_tranches = (fin - debut + TAILLE_TRANCHE - 1) / TAILLE_TRANCHE;
+  if (nb_tranches <= 1)
+    {
+      for (int i = debut; i < fin; i++) f(i, sommes);
+      return;
+    }
+  std::vector<_TYPE_> partielles(nb_tranches * nb_sommes, (_TYPE_)0);
+  _TYPE_ *partielles_ptr = partielles.data();
+  Kokkos::parallel_for("somme_hote_par_tranches", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nb_tranches), [=](const int t)
+  {
+    const int fin_tranche = std::min(fin, debut + (t + 1) * TAILLE_TRANCHE);
+    for (int i = debut + t * TAILLE_TRANCHE; i < fin_tranche; i++) f(i, partielles_ptr + t * nb_sommes);
+  });
+  Kokkos::fence();
+  for (int t = 0; t < nb_tranches; t++)
+    for (int k = 0; k < nb_sommes; k++)
+      sommes[k] += partielles_ptr[t * nb_sommes + k];
+}
+
+template <typename _TYPE_>
+_TYPE_ combinaison_lineaire_generic(TRUSTVect<_TYPE_>& resu, _TYPE_ beta, const TRUSTVect<_TYPE_>& x0, int n, const _TYPE_ *alpha, const TRUSTVect<_TYPE_> *const *vx, const TRUSTVect<_TYPE_> *vy, Mp_vect_options opt)
+{
+  assert(n >= 0 && n <= NB_MAX_COMBINAISON_LINEAIRE);
+  _TYPE_ sum = 0;
+  // Master vect donne la structure de reference, les autres vecteurs doivent avoir la meme structure.
+  const TRUSTVect<_TYPE_>& master_vect = resu;
+  const int line_size = master_vect.line_size(), vect_size_tot = master_vect.size_totale();
+  const MD_Vector& md = master_vect.get_md_vector();
+  assert(x0.line_size() == line_size && x0.size_totale() == vect_size_tot); // this test is necessary if md is null
+  for (int i = 0; i < n; i++) assert(vx[i]->line_size() == line_size && vx[i]->size_totale() == vect_size_tot);
+  assert(!vy || (vy->line_size() == line_size && vy->size_totale() == vect_size_tot));
+#ifndef LATATOOLS
+  assert(x0.get_md_vector() == md && (!vy || vy->get_md_vector() == md));
+  for (int i = 0; i < n; i++) assert(vx[i]->get_md_vector() == md);
+#endif
+  if (vect_size_tot == 0) // raccourci pour les tableaux vides (evite le cas particulier line_size == 0)
+    return sum;
+  std::vector<int> sous_blocs;
+  blocs_mise_a_jour_et_somme(md, vect_size_tot / line_size, opt, sous_blocs);
+
+  // Le kernel n'est lance sur le device que si tous les tableaux y sont a jour
+  bool kernelOnDevice = resu.checkDataOnDevice(x0) && (!vy || vy->isDataOnDevice());
+  for (int i = 0; i < n; i++) kernelOnDevice = kernelOnDevice && vx[i]->isDataOnDevice();
+  if (!kernelOnDevice)
+    {
+      resu.checkDataOnHost(), x0.checkDataOnHost();
+      for (int i = 0; i < n; i++) vx[i]->checkDataOnHost();
+      if (vy) vy->checkDataOnHost();
+    }
+  // les vecteurs confondus avec resu (x0 = resu, vy = resu...) sont lus a travers le pointeur de resu
+  _TYPE_ *resu_base = computeOnTheDevice(resu, "", kernelOnDevice);
+  auto lire = [&](const TRUSTVect<_TYPE_>& v) -> const _TYPE_ * { return (&v == &resu) ? resu_base : mapToDevice(v, "", kernelOnDevice); };
+  const _TYPE_ *x0_base = lire(x0), *y_base = vy ? lire(*vy) : nullptr;
+  const _TYPE_ *x_base[NB_MAX_COMBINAISON_LINEAIRE] = { x0_base, x0_base, x0_base, x0_base };
+  _TYPE_ a[NB_MAX_COMBINAISON_LINEAIRE] = { 0, 0, 0, 0 };
+  for (int i = 0; i < n; i++) x_base[i] = lire(*vx[i]), a[i] = alpha[i];
+  const _TYPE_ a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+  start_gpu_timer();
+  const int nb_sous_blocs = (int)sous_blocs.size() / 3;
+  for (int b = 0; b < nb_sous_blocs; b++)
+    {
+      const int begin_bloc = sous_blocs[3 * b] * line_size, end_bloc = sous_blocs[3 * b + 1] * line_size;
+      assert(begin_bloc >= 0 && end_bloc <= vect_size_tot && end_bloc >= begin_bloc);
+      _TYPE_ *resu_ptr = resu_base;
+      const _TYPE_ *x0_ptr = x0_base, *x1_ptr = x_base[0], *x2_ptr = x_base[1], *x3_ptr = x_base[2], *x4_ptr = x_base[3], *y_ptr = y_base;
+      if (!y_ptr || !sous_blocs[3 * b + 2])
+        {
+          #pragma omp target teams distribute parallel for if (kernelOnDevice)
+          for (int i = begin_bloc; i < end_bloc; i++)
+            {
+              _TYPE_ r = beta * x0_ptr[i];
+              if (n > 0) r += a0 * x1_ptr[i];
+              if (n > 1) r += a1 * x2_ptr[i];
+              if (n > 2) r += a2 * x3_ptr[i];
+              if (n > 3) r += a3 * x4_ptr[i];
+              resu_ptr[i] = r;
+            }
+        }
+      else if (kernelOnDevice)
+        {
+          #pragma omp target teams distribute parallel for reduction(+:sum)
+          for (int i = begin_bloc; i < end_bloc; i++)
+            {
+              _TYPE_ r = beta * x0_ptr[i];
+              if (n > 0) r += a0 * x1_ptr[i];
+              if (n > 1) r += a1 * x2_ptr[i];
+              if (n > 2) r += a2 * x3_ptr[i];
+              if (n > 3) r += a3 * x4_ptr[i];
+              resu_ptr[i] = r;
+              sum += r * y_ptr[i];
+            }
+        }
+      else // sur l'hote : reduction repartie sur les threads
+        somme_hote_par_tranches(begin_bloc, end_bloc, 1, [=](const int i, _TYPE_ *s)
+        {
+          _TYPE_ r = beta * x0_ptr[i];
+          if (n > 0) r += a0 * x1_ptr[i];
+          if (n > 1) r += a1 * x2_ptr[i];
+          if (n > 2) r += a2 * x3_ptr[i];
+          if (n > 3) r += a3 * x4_ptr[i];
+          resu_ptr[i] = r;
+          s[0] += r * y_ptr[i];
+        }, &sum);
+    }
+  if (timer) end_gpu_timer(kernelOnDevice, vy ? "combinaison_lineaire(resu,beta,x0,alpha,vx,vy)" : "combinaison_lineaire(resu,beta,x0,alpha,vx)");
+  // In debug mode, put invalid values where data has not been computed
+#ifndef NDEBUG
+  invalidate_data(resu, opt);
+#endif
+  return sum;
+}
+// Explicit instanciation for templates:
+template double combinaison_lineaire_generic<double>(TRUSTVect<double>& resu, double beta, const TRUSTVect<double>& x0, int n, const double *alpha, const TRUSTVect<double> *const *vx, const TRUSTVect<double> *vy, Mp_vect_options opt);
+template float combinaison_lineaire_generic<float>(TRUSTVect<float>& resu, float beta, const TRUSTVect<float>& x0, int n, const float *alpha, const TRUSTVect<float> *const *vx, const TRUSTVect<float> *vy, Mp_vect_options opt);
+
 template <typename _TYPE_, TYPE_OPERATOR_VECT _TYPE_OP_ >
 void operator_vect_vect_generic(TRUSTVect<_TYPE_>& resu, const TRUSTVect<_TYPE_>& vx, Mp_vect_options opt)
 {
@@ -660,8 +826,7 @@ _TYPE_ local_prodscal(const TRUSTVect<_TYPE_>& vx, const TRUSTVect<_TYPE_>& vy,
         for (int i=begin_bloc; i<end_bloc; i++)
           sum += vx_ptr[i] * vy_ptr[i];
       else
-        for (int i=begin_bloc; i<end_bloc; i++)
-          sum += vx_ptr[i] * vy_ptr[i];
+        somme_hote_par_tranches(begin_bloc, end_bloc, 1, [=](const int i, _TYPE_ *s) { s[0] += vx_ptr[i] * vy_ptr[i]; }, &sum);
     }
   if (timer) end_gpu_timer(kernelOnDevice, "local_prodscal(vx,vy)");
   return sum;
@@ -669,3 +834,92 @@ _TYPE_ local_prodscal(const TRUSTVect<_TYPE_>& vx, const TRUSTVect<_TYPE_>& vy,
 // Explicit instanciation for templates:
 template double local_prodscal(const TRUSTVect<double>& vx, const TRUSTVect<double>& vy, Mp_vect_options opt);
 template float local_prodscal(const TRUSTVect<float>& vx, const TRUSTVect<float>& vy, Mp_vect_options opt);
+
+template <typename _TYPE_>
+void local_prodscal_multiple(const TRUSTVect<_TYPE_>& vx, int n, const TRUSTVect<_TYPE_> *const *vy, _TYPE_ *res, Mp_vect_options opt)
+{
+  assert(n >= 0 && n <= NB_MAX_COMBINAISON_LINEAIRE);
+  for (int k = 0; k < n; k++) res[k] = 0;
+  // Master vect donne la structure de reference, les autres vecteurs doivent avoir la meme structure.
+  const TRUSTVect<_TYPE_>& master_vect = vx;
+  const int line_size = master_vect.line_size(), vect_size_tot = master_vect.size_totale();
+  const MD_Vector& md = master_vect.get_md_vector();
+  for (int k = 0; k < n; k++) assert(vy[k]->line_size() == line_size && vy[k]->size_totale() == vect_size_tot); // this test is necessary if md is null
+#ifndef LATATOOLS
+  for (int k = 0; k < n; k++) assert(vy[k]->get_md_vector() == md);
+#endif
+  // Determine blocs of data to process, depending on " VECT_SEQUENTIAL_ITEMS"
+  int nblocs_left = 1, one_bloc[2];
+  const int *bloc_ptr;
+#ifndef LATATOOLS
+  if (opt != VECT_ALL_ITEMS && md.non_nul() && Process::is_parallel())
+    {
+      assert(opt == VECT_SEQUENTIAL_ITEMS || opt == VECT_REAL_ITEMS);
+      const TRUSTArray<int>& items_blocs = (opt == VECT_SEQUENTIAL_ITEMS) ? md.valeur().get_items_to_sum() : md.valeur().get_items_to_compute();
+      assert(items_blocs.size_array() % 2 == 0);
+      nblocs_left = items_blocs.size_array() >> 1;
+      bloc_ptr = items_blocs.addr();
+    }
+  else
+#endif
+    if (vect_size_tot > 0 && n > 0)
+      {
+        nblocs_left = 1;
+        bloc_ptr = one_bloc;
+        one_bloc[0] = 0;
+        one_bloc[1] = vect_size_tot / line_size;
+      }
+    else // raccourci pour les tableaux vides (evite le cas particulier line_size == 0)
+      return;
+
+  bool kernelOnDevice = vx.isDataOnDevice();
+  for (int k = 0; k < n; k++) kernelOnDevice = kernelOnDevice && vy[k]->isDataOnDevice();
+  if (!kernelOnDevice)
+    {
+      vx.checkDataOnHost();
+      for (int k = 0; k < n; k++) vy[k]->checkDataOnHost();
+    }
+  const _TYPE_ *x_ptr = mapToDevice(vx, "", kernelOnDevice);
+  const _TYPE_ *y_base[NB_MAX_COMBINAISON_LINEAIRE] = { x_ptr, x_ptr, x_ptr, x_ptr };
+  for (int k = 0; k < n; k++) y_base[k] = mapToDevice(*vy[k], "", kernelOnDevice);
+  const _TYPE_ *y0_ptr = y_base[0], *y1_ptr = y_base[1], *y2_ptr = y_base[2], *y3_ptr = y_base[3];
+  _TYPE_ s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  start_gpu_timer();
+  for (; nblocs_left; nblocs_left--)
+    {
+      // Get index of next bloc start:
+      const int begin_bloc = (*(bloc_ptr++)) * line_size, end_bloc = (*(bloc_ptr++)) * line_size;
+      assert(begin_bloc >= 0 && end_bloc <= vect_size_tot && end_bloc >= begin_bloc);
+      if (kernelOnDevice)
+        {
+          #pragma omp target teams distribute parallel for reduction(+:s0,s1,s2,s3)
+          for (int i = begin_bloc; i < end_bloc; i++)
+            {
+              const _TYPE_ x = x_ptr[i];
+              s0 += x * y0_ptr[i];
+              if (n > 1) s1 += x * y1_ptr[i];
+              if (n > 2) s2 += x * y2_ptr[i];
+              if (n > 3) s3 += x * y3_ptr[i];
+            }
+        }
+      else
+        {
+          _TYPE_ s[NB_MAX_COMBINAISON_LINEAIRE] = { s0, s1, s2, s3 };
+          somme_hote_par_tranches(begin_bloc, end_bloc, NB_MAX_COMBINAISON_LINEAIRE, [=](const int i, _TYPE_ *sp)
+          {
+            const _TYPE_ x = x_ptr[i];
+            sp[0] += x * y0_ptr[i];
+            if (n > 1) sp[1] += x * y1_ptr[i];
+            if (n > 2) sp[2] += x * y2_ptr[i];
+            if (n > 3) sp[3] += x * y3_ptr[i];
+          }, s);
+          s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+        }
+    }
+  if (timer) end_gpu_timer(kernelOnDevice, "local_prodscal_multiple(vx,vy)");
+  const _TYPE_ s[NB_MAX_COMBINAISON_LINEAIRE] = { s0, s1, s2, s3 };
+  for (int k = 0; k < n; k++) res[k] = s[k];
+}
+// Explicit instanciation for templates:
+template void local_prodscal_multiple<double>(const TRUSTVect<double>& vx, int n, const TRUSTVect<double> *const *vy, double *res, Mp_vect_options opt);
+template void local_prodscal_multiple<float>(const TRUSTVect<float>& vx, int n, const TRUSTVect<float> *const *vy, float *res, Mp_vect_options opt);
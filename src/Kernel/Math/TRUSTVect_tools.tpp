@@ -445,6 +445,52 @@ inline void ajoute_carre_(TRUSTVect<_TYPE_>& resu, _TYPE_ alpha, const TRUSTVect
   ajoute_carre(resu,alpha,vx,opt);
 }
 
+// resu = beta * x0 + sum_{i<n} alpha[i] * vx[i] sur les items de opt en un seul passage memoire (n <= NB_MAX_COMBINAISON_LINEAIRE,
+// x0, vx[i] et vy peuvent etre resu). Si vy est non nul, renvoie aussi la somme locale des resu[i] * vy[i] (resu apres mise a jour)
+// sur les items sequentiels, sinon 0.
+static constexpr int NB_MAX_COMBINAISON_LINEAIRE = 4;
+
+inline int combinaison_lineaire_generic(TRUSTVect<int>& resu, int beta, const TRUSTVect<int>& x0, int n, const int *alpha, const TRUSTVect<int> *const *vx, const TRUSTVect<int> *vy, Mp_vect_options opt) = delete; // forbidden ... ajoute si besoin
+
+template <typename _TYPE_>
+extern _TYPE_ combinaison_lineaire_generic(TRUSTVect<_TYPE_>& resu, _TYPE_ beta, const TRUSTVect<_TYPE_>& x0, int n, const _TYPE_ *alpha, const TRUSTVect<_TYPE_> *const *vx, const TRUSTVect<_TYPE_> *vy, Mp_vect_options opt);
+
+inline void combinaison_lineaire(TRUSTVect<int>& resu, int beta, const TRUSTVect<int>& x0, int n, const int *alpha, const TRUSTVect<int> *const *vx, Mp_vect_options opt = VECT_ALL_ITEMS) = delete; // forbidden ... ajoute si besoin
+
+template <typename _TYPE_>
+inline void combinaison_lineaire(TRUSTVect<_TYPE_>& resu, _TYPE_ beta, const TRUSTVect<_TYPE_>& x0, int n, const _TYPE_ *alpha, const TRUSTVect<_TYPE_> *const *vx, Mp_vect_options opt = VECT_ALL_ITEMS)
+{
+  combinaison_lineaire_generic<_TYPE_>(resu, beta, x0, n, alpha, vx, nullptr, opt);
+}
+
+// resu += alpha * vx et renvoie la somme locale des resu[i] * vy[i] sur les items sequentiels. Avec vy = resu on obtient le carre
+// de la norme locale du resultat.
+inline int ajoute_alpha_v_prodscal(TRUSTVect<int>& resu, int alpha, const TRUSTVect<int>& vx, const TRUSTVect<int>& vy, Mp_vect_options opt = VECT_REAL_ITEMS) = delete; // forbidden ... ajoute si besoin
+
+template <typename _TYPE_>
+inline _TYPE_ ajoute_alpha_v_prodscal(TRUSTVect<_TYPE_>& resu, _TYPE_ alpha, const TRUSTVect<_TYPE_>& vx, const TRUSTVect<_TYPE_>& vy, Mp_vect_options opt = VECT_REAL_ITEMS)
+{
+  const TRUSTVect<_TYPE_> *v = &vx;
+  return combinaison_lineaire_generic<_TYPE_>(resu, (_TYPE_)1, resu, 1, &alpha, &v, &vy, opt);
+}
+
+// resu = vx + beta * resu et renvoie le carre de la norme locale du resultat sur les items sequentiels, en un seul passage memoire
+inline int multiplie_ajoute_v_carre_norme(TRUSTVect<int>& resu, int beta, const TRUSTVect<int>& vx, Mp_vect_options opt = VECT_REAL_ITEMS) = delete; // forbidden ... ajoute si besoin
+
+template <typename _TYPE_>
+inline _TYPE_ multiplie_ajoute_v_carre_norme(TRUSTVect<_TYPE_>& resu, _TYPE_ beta, const TRUSTVect<_TYPE_>& vx, Mp_vect_options opt = VECT_REAL_ITEMS)
+{
+  const TRUSTVect<_TYPE_> *v = &vx;
+  const _TYPE_ un = 1;
+  return combinaison_lineaire_generic<_TYPE_>(resu, beta, resu, 1, &un, &v, &resu, opt);
+}
+
+// res[k] = somme locale des vx[i] * vy[k][i] pour k < n (n <= NB_MAX_COMBINAISON_LINEAIRE), en un seul passage memoire sur vx
+inline void local_prodscal_multiple(const TRUSTVect<int>& vx, int n, const TRUSTVect<int> *const *vy, int *res, Mp_vect_options opt = VECT_SEQUENTIAL_ITEMS) = delete; // forbidden ... ajoute si besoin
+
+template <typename _TYPE_>
+extern void local_prodscal_multiple(const TRUSTVect<_TYPE_>& vx, int n, const TRUSTVect<_TYPE_> *const *vy, _TYPE_ *res, Mp_vect_options opt = VECT_SEQUENTIAL_ITEMS);
+
 // ToDo OpenMP offload in .cpp (mais semble pas utilise...)
 template <typename _TYPE_>
 inline void ajoute_produit_scalaire(TRUSTVect<_TYPE_>& resu, _TYPE_ alpha, const TRUSTVect<_TYPE_>& vx, const TRUSTVect<_TYPE_>& vy, Mp_vect_options opt = VECT_ALL_ITEMS)
@@ -13,6 +13,7 @@
 *
 *****************************************************************************/
 
+#include <Memoire_Partagee_Noeud.h>
 #include <Table.h>
 #include <utility>
 
@@ -324,3 +325,13 @@ void Table::remplir(const DoubleVects& params, const DoubleVect& aval)
   les_parametres.dimensionner(params.size());
   for (int i = 0; i < params.size(); i++) les_parametres[i].ref(params[i]);
 }
+
+/*! @brief Fait porter les valeurs d'une grande table par une copie unique par noeud (voir Memoire_Partagee_Noeud).
+ *
+ * Collectif : a appeler sur tous les processeurs une fois la table remplie. La table ne doit plus etre modifiee ensuite.
+ */
+void Table::partager_memoire_noeud()
+{
+  if (les_valeurs.nb_dim() == 1 && !les_valeurs.get_md_vector().non_nul())
+    Memoire_Partagee_Noeud::partager(les_valeurs);
+}
@@ -45,6 +45,7 @@ public :
   Entree& lire_f(Entree& is, const int nb_comp);
   Entree& lire_fxyzt(Entree& is,const int dim);
   inline const int& isfonction() const;
+  void partager_memoire_noeud();
   Table(const Table&);
   Table& operator=(const Table& t) = default; // exige par gcc 9 car sinon error: implicitly-declared 'Table& Table::operator=(const Table&)' is deprecated [-Werror=deprecated-copy]
 
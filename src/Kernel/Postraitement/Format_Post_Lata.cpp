@@ -22,6 +22,7 @@
 #include <sys/stat.h>
 #include <Param.h>
 #include <string> // Necessaire avec xlC pour std::getline
+#include <climits>
 
 Implemente_instanciable_sans_constructeur(Format_Post_Lata,"Format_Post_Lata",Format_Post_base);
 
@@ -621,10 +622,19 @@ int Format_Post_Lata::ecrire_domaine_low_level(const Nom& id_domaine, const Doub
         // Le processeur 0 numerote ses sommets de 1 a n0
         // Le processeur 1 numerote ses sommets de n0+1 a n0+n1, etc...
         // Decalage a ajouter aux indices pour avoir une numerotation globale.
+        // Decalages calcules sur 64 bits ; les indices du fichier lata etant des int, ils doivent tenir sur un int
         const int nbsom = sommets.dimension(0);
-        decalage_sommets += mppartial_sum(nbsom);
+        const trustIdType decalage_sommets_long = decalage_sommets + Process::mppartial_sum_as_long(nbsom);
         const int nbelem = elements.dimension(0);
-        decalage_elements += mppartial_sum(nbelem);
+        const trustIdType decalage_elements_long = decalage_elements + Process::mppartial_sum_as_long(nbelem);
+        if (decalage_sommets_long + nbsom > INT_MAX || decalage_elements_long + nbelem > INT_MAX)
+          {
+            Cerr << "Error in Format_Post_Lata : the global numbering of the nodes or elements exceeds the capacity of an int ("
+                 << INT_MAX << ") in a single lata file." << finl;
+            Process::exit();
+          }
+        decalage_sommets = (int) decalage_sommets_long;
+        decalage_elements = (int) decalage_elements_long;
       }
 
     if (un_seul_fichier_lata_)
@@ -358,26 +358,15 @@ static Nom translate_keyword(const Nom& french_keyword)
   return english_keyword;
 }
 
-static EChaineJDD read_and_broadcast_file(const Nom& filename)
+static EChaineJDD read_file(const Nom& filename)
 {
-  // Proc 0 read file and fills its "file_content"
+  // LecFicDiffuse_JDD diffuse deja le contenu pretraite du fichier : chaque processeur lit sa copie locale
   LecFicDiffuse_JDD file_stream(filename, ios::in, true);
-  long unsigned int file_char_number;
+  std::stringstream buffer;
+  buffer << file_stream.get_entree_master().get_istream().rdbuf();
   Nom file_content("{ ");
-  if (Process::je_suis_maitre())
-    {
-      std::stringstream buffer;
-      buffer << file_stream.get_entree_master().get_istream().rdbuf();
-      file_content += buffer.str();
-      file_content += " }";
-      file_char_number = file_content.getString().size()-4;
-    }
-  // Proc0 sends its "file_content" to other procs
-  envoyer_broadcast(file_char_number, 0);
-  file_content.getString().resize(file_char_number+4); // +4 for braces and spaces
-  envoyer_broadcast_array(&file_content.getString()[2], (int)file_char_number, 0);
-  file_content.getString()[file_char_number+2] = ' ';
-  file_content.getString()[file_char_number+3] = '}';
+  file_content += buffer.str();
+  file_content += " }";
   // We build an EChaine to interpret the file
   return EChaineJDD(file_content);
 }
@@ -390,7 +379,7 @@ static EChaineJDD get_file_content_for_bloc(const Nom& associated_word, Entree&
   param2.lire_avec_accolades_depuis(s);
 
   Cerr << "Reading of "<<associated_word<<" from file "<<filename<< finl;
-  return read_and_broadcast_file(filename);
+  return read_file(filename);
 }
 
 void Postraitement::set_param(Param& param)
@@ -1529,7 +1518,7 @@ void Postraitement::postprocess_field_values()
       //Le champ cree est rendu dans champ_ecriture
 
       Champ espace_stockage;
-      const Champ_base& champ_ecriture = champ.get_champ(espace_stockage);
+      const Champ_base& champ_ecriture = champ.get_champ_memorise(espace_stockage);
       DoubleTab val_vec;
       bool isChamp_Face_PolyMAC = (champ_ecriture.que_suis_je().debute_par("Champ_Face_PolyMAC") || champ_ecriture.que_suis_je().debute_par("Champ_Fonc_Face_PolyMAC"));
       if (isChamp_Face_PolyMAC)
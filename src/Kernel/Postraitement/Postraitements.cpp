@@ -15,6 +15,7 @@
 
 #include <Postraitements.h>
 #include <Postraitement.h>
+#include <Champ_Generique_base.h>
 
 Implemente_instanciable(Postraitements,"Postraitements|Post_processings",LIST(DERIV(Postraitement_base)));
 
@@ -205,31 +206,39 @@ int Postraitements::lire_postraitements(Entree& is, const Motcle& motlu, const P
   return 1;
 }
 
+// Les sous-arbres de champs generiques communs a plusieurs blocs ne sont evalues qu'une fois par passe
 void Postraitements::postraiter()
 {
+  Champ_Generique_base::activer_cache_evaluation();
   for (auto& itr : *this)
     {
       Postraitement_base& post = itr.valeur();
       post.postraiter(1); // On force le postraitement
     }
+  Champ_Generique_base::desactiver_cache_evaluation();
 }
 
 void Postraitements::traiter_postraitement()
 {
+  Champ_Generique_base::activer_cache_evaluation();
   for (auto& itr : *this)
     {
       Postraitement_base& post = itr.valeur();
       post.postraiter(0); // Postraitement si intervalle de temps ecoule
     }
+  Champ_Generique_base::desactiver_cache_evaluation();
 }
 
+// Chaque champ source des statistiques n'est evalue qu'une fois par pas de temps
 void Postraitements::mettre_a_jour(double temps)
 {
+  Champ_Generique_base::activer_cache_evaluation();
   for (auto& itr : *this)
     {
       Postraitement_base& post = itr.valeur();
       post.mettre_a_jour(temps);
     }
+  Champ_Generique_base::desactiver_cache_evaluation();
 }
 
 void Postraitements::resetTime(double t, const std::string dirname)
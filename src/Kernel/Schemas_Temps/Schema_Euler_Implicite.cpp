@@ -536,6 +536,7 @@ int Schema_Euler_Implicite::faire_un_pas_de_temps_pb_couple(Probleme_Couple& pbc
       test_stationnaire(ref_cast(Probleme_base,pbc.probleme(i)));
       residu_=std::max(residu_,residu_1);
     }
+  reduire_criteres_statio();
 
   return 1;
 }
@@ -379,6 +379,7 @@ int Schema_Implicite_Multi_TimeStep_base::faire_un_pas_de_temps_pb_couple(Proble
       test_stationnaire(ref_cast(Probleme_base,pbc.probleme(i)));
       residu_=std::max(residu_,residu_1);
     }
+  reduire_criteres_statio();
 
   return 1;
 }
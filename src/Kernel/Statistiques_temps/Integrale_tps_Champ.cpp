@@ -13,7 +13,10 @@
 *
 *****************************************************************************/
 
+#include <Integrale_tps_produit_champs.h>
 #include <Integrale_tps_Champ.h>
+#include <TRUSTTab.h>
+#include <Device.h>
 
 Implemente_instanciable(Integrale_tps_Champ,"Integrale_tps_Champ",Champ_Fonc);
 
@@ -42,10 +45,6 @@ Entree& Integrale_tps_Champ::readOn(Entree& s)
  */
 void Integrale_tps_Champ::mettre_a_jour_integrale()
 {
-
-
-  Champ espace_stockage_source;
-  const Champ_base& source = mon_champ->get_champ(espace_stockage_source);
   double t_courant = mon_champ->get_time();
 
   if (t_fin_ < t_debut_)
@@ -57,12 +56,16 @@ void Integrale_tps_Champ::mettre_a_jour_integrale()
   if ( inf_ou_egal(t_debut_ ,t_courant) &&  inf_ou_egal(t_courant,t_fin_) )
     {
       double dt = t_courant - tps_integrale;
+      // dt nul si l'integrale a deja ete avancee par une integrale pilote (voir accumuler_fusionne) :
+      // on n'evalue alors pas le champ source.
       if (dt > 0)
         {
+          Champ espace_stockage_source;
+          const Champ_base& source = mon_champ->get_champ_memorise(espace_stockage_source);
           const DoubleTab& val = source.valeurs();
           DoubleTab& mes_val = valeurs();
           if (puissance == 1)
-            mes_val.ajoute(dt,val);
+            accumuler_fusionne(dt, val, t_courant);
           else if (puissance == 2)
             mes_val.ajoute_carre(dt,val);
           else
@@ -73,3 +76,136 @@ void Integrale_tps_Champ::mettre_a_jour_integrale()
         }
     }
 }
+
+// Deux champs generiques distincts designent la meme source s'ils ont la meme signature non vide
+static int meme_source(const Champ_Generique_base& a, const Champ_Generique_base& b)
+{
+  if (&a == &b)
+    return 1;
+  const Nom sig = a.signature();
+  return sig != "" && sig == b.signature();
+}
+
+/*! @brief Rattache l'integrale du carre du meme champ source : elle sera mise a jour dans le meme parcours que cette integrale.
+ *
+ * Sans effet si la source ne peut pas etre identifiee a celle de cette integrale.
+ */
+void Integrale_tps_Champ::rattacher_carre(Integrale_tps_Champ& integrale_carre)
+{
+  assert(puissance == 1 && integrale_carre.puissance == 2);
+  if (!carre_rattache_.non_nul() && meme_source(integrale_carre.le_champ().valeur(), mon_champ.valeur()))
+    carre_rattache_ = integrale_carre;
+}
+
+/*! @brief Rattache l'integrale d'un produit dont le premier champ est le champ source de cette integrale.
+ *
+ * Sans effet si le premier champ du produit ne peut pas etre identifie a la source de cette integrale.
+ */
+void Integrale_tps_Champ::rattacher_produit(Integrale_tps_produit_champs& integrale_produit)
+{
+  assert(puissance == 1);
+  if (!meme_source(integrale_produit.mon_premier_champ().valeur(), mon_champ.valeur()))
+    return;
+  for (const auto& itr : produits_rattaches_)
+    if (&itr.valeur() == &integrale_produit)
+      return;
+  produits_rattaches_.add(integrale_produit);
+}
+
+/*! @brief Une integrale rattachee n'est avancee avec celle-ci que si elle est dans le meme etat (bornes et temps d'integration, taille).
+ *
+ * Sinon elle se met a jour elle-meme lors de son propre appel a mettre_a_jour_integrale().
+ */
+int Integrale_tps_Champ::fusion_possible(const Integrale_tps_Champ& integrale, const DoubleTab& val) const
+{
+  return est_egal(integrale.t_debut_, t_debut_) && est_egal(integrale.t_fin_, t_fin_)
+         && est_egal(integrale.tps_integrale, tps_integrale)
+         && integrale.valeurs().dimension_tot(0) == val.dimension_tot(0);
+}
+
+/*! @brief Ajoute dt*val a l'integrale et, dans le meme parcours, dt*val^2 a l'integrale du carre
+ *
+ *     et dt*val(x)val_b aux integrales de produit rattachees. Le champ val n'est ainsi lu qu'une fois par pas de temps
+ *     quel que soit le nombre de statistiques qui en dependent.
+ *
+ */
+void Integrale_tps_Champ::accumuler_fusionne(double dt, const DoubleTab& val, double t_courant)
+{
+  static constexpr int NB_MAX_PRODUITS_FUSIONNES = 8;
+  DoubleTab& mes_val = valeurs();
+  const int nb_lignes = mes_val.dimension_tot(0), nb_comp = mes_val.line_size();
+
+  const bool avec_carre = carre_rattache_.non_nul() && fusion_possible(carre_rattache_.valeur(), mes_val)
+                          && carre_rattache_->valeurs().line_size() == nb_comp;
+
+  // Seconds champs des produits : evalues une fois (cache de la passe de post-traitement)
+  Champ espaces_stockage_b[NB_MAX_PRODUITS_FUSIONNES];
+  Integrale_tps_produit_champs *produits[NB_MAX_PRODUITS_FUSIONNES];
+  const DoubleTab *valeurs_b[NB_MAX_PRODUITS_FUSIONNES];
+  int nb_produits = 0;
+  for (auto& itr : produits_rattaches_)
+    {
+      Integrale_tps_produit_champs& produit = itr.valeur();
+      if (nb_produits == NB_MAX_PRODUITS_FUSIONNES || produit.get_support_different() || !fusion_possible(produit, mes_val)
+          || produit.mon_second_champ()->get_time() != t_courant)
+        continue;
+      const DoubleTab& vb = produit.mon_second_champ()->get_champ_memorise(espaces_stockage_b[nb_produits]).valeurs();
+      if (vb.dimension_tot(0) != nb_lignes || produit.valeurs().line_size() != nb_comp * vb.line_size())
+        continue;
+      produits[nb_produits] = &produit;
+      valeurs_b[nb_produits] = &vb;
+      nb_produits++;
+    }
+
+  if (!avec_carre && nb_produits == 0)
+    {
+      mes_val.ajoute(dt,val);
+      return;
+    }
+
+  CDoubleTabView v = val.view_ro();
+  DoubleTabView integrale = mes_val.view_rw();
+  DoubleTabView carre;
+  if (avec_carre)
+    carre = carre_rattache_->valeurs().view_rw();
+  CDoubleTabView vb[NB_MAX_PRODUITS_FUSIONNES];
+  DoubleTabView produit[NB_MAX_PRODUITS_FUSIONNES];
+  int nb_comp_b[NB_MAX_PRODUITS_FUSIONNES];
+  for (int p = 0; p < nb_produits; p++)
+    {
+      vb[p] = valeurs_b[p]->view_ro();
+      produit[p] = produits[p]->valeurs().view_rw();
+      nb_comp_b[p] = valeurs_b[p]->line_size();
+    }
+
+  auto kern = KOKKOS_LAMBDA(int i)
+  {
+    for (int c = 0; c < nb_comp; c++)
+      {
+        const double x = v(i, c);
+        integrale(i, c) += dt * x;
+        if (avec_carre)
+          carre(i, c) += dt * x * x;
+        for (int p = 0; p < nb_produits; p++)
+          for (int k = 0; k < nb_comp_b[p]; k++)
+            produit[p](i, c * nb_comp_b[p] + k) += dt * x * vb[p](i, k);
+      }
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Integrale_tps_Champ::accumuler_fusionne", nb_lignes, kern);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Integrale_tps_Champ::accumuler_fusionne");
+
+  mes_val.echange_espace_virtuel(); // comme ajoute()
+
+  // Les integrales rattachees sont avancees au meme temps : leur propre mise a jour n'aura plus rien a faire
+  if (avec_carre)
+    {
+      carre_rattache_->tps_integrale = t_courant;
+      carre_rattache_->dt_integr_calcul += dt;
+    }
+  for (int p = 0; p < nb_produits; p++)
+    {
+      produits[p]->tps_integrale = t_courant;
+      produits[p]->dt_integr_calcul += dt;
+    }
+}
@@ -19,8 +19,10 @@
 #include <Champ_Generique_base.h>
 #include <TRUSTTabs_forward.h>
 #include <Champ_Fonc.h>
+#include <TRUST_List.h>
 #include <TRUST_Ref.h>
 
+class Integrale_tps_produit_champs;
 class Domaine_dis_base;
 class Champ_base;
 
@@ -41,13 +43,21 @@ public:
   inline void associer(const Champ_Generique_base&, int, double, double);
   virtual inline void mettre_a_jour(double );
   virtual void mettre_a_jour_integrale();
+  void rattacher_carre(Integrale_tps_Champ&);
+  void rattacher_produit(Integrale_tps_produit_champs&);
 
 protected :
+  int fusion_possible(const Integrale_tps_Champ&, const DoubleTab&) const;
+  void accumuler_fusionne(double dt, const DoubleTab& val, double t_courant);
 
   REF(Champ_Generique_base) mon_champ;
   int puissance = -10;
   double t_debut_ = -100., t_fin_= -100.;
   double tps_integrale= -100., dt_integr_calcul= -100.;
+
+  // Integrales portant sur le meme champ source, mises a jour dans le meme parcours que celle-ci
+  REF(Integrale_tps_Champ) carre_rattache_;
+  LIST(REF(Integrale_tps_produit_champs)) produits_rattaches_;
 };
 
 inline void Integrale_tps_Champ::associer(const Champ_Generique_base& le_ch, int n, double t0, double t1)
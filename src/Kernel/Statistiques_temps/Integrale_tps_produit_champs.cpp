@@ -37,18 +37,15 @@ Entree& Integrale_tps_produit_champs::readOn(Entree& s)
  */
 void Integrale_tps_produit_champs::mettre_a_jour_integrale()
 {
-  Champ espace_stockage_source,espace_stockage_source2;
-  const Champ_base& source = mon_premier_champ()->get_champ(espace_stockage_source);
-  const Champ_base& source2 = mon_second_champ()->get_champ(espace_stockage_source2);
-  const Noms nom = mon_premier_champ()->get_property("nom");
-  const Noms nom2 = mon_second_champ()->get_property("nom");
   double t_courant = mon_premier_champ()->get_time();
 
   if (t_courant != mon_second_champ()->get_time())
     {
+      const Noms nom = mon_premier_champ()->get_property("nom");
+      const Noms nom2 = mon_second_champ()->get_property("nom");
       Cerr << "Integrale_tps_produit_champs::mettre_a_jour_integrale()" << finl;
       Cerr << "the current time of the field named " << nom[0] << " =" << t_courant << finl;
-      Cerr << "is different of the second field current time " << nom2[0] << " =" <<  source2.temps() << finl;
+      Cerr << "is different of the second field current time " << nom2[0] << " =" <<  mon_second_champ()->get_time() << finl;
       exit();
     }
   if (t_fin_ < t_debut_)
@@ -60,12 +57,14 @@ void Integrale_tps_produit_champs::mettre_a_jour_integrale()
   if ( inf_ou_egal(t_debut_ ,t_courant) &&  inf_ou_egal(t_courant,t_fin_) )
     {
       double dt = t_courant - tps_integrale;
+      // dt nul si l'integrale a deja ete avancee avec la moyenne du premier champ (Integrale_tps_Champ::accumuler_fusionne)
       if (dt > 0)
         {
-          //DoubleTab& mes_val = valeurs();
           if (premiere_puissance() == 1 && seconde_puissance() == 1)
             {
-              ////ajoute_produit_tensoriel(dt, mon_premier_champ(), mon_second_champ());
+              Champ espace_stockage_source,espace_stockage_source2;
+              const Champ_base& source = mon_premier_champ()->get_champ_memorise(espace_stockage_source);
+              const Champ_base& source2 = mon_second_champ()->get_champ_memorise(espace_stockage_source2);
               ajoute_produit_tensoriel(dt, source, source2);
             }
           else
@@ -80,6 +79,14 @@ void Integrale_tps_produit_champs::mettre_a_jour_integrale()
 }
 
 void Integrale_tps_produit_champs::ajoute_produit_tensoriel(double alpha, const Champ_base& a, const Champ_base& b)
+{
+  ajoute_produit_tensoriel(valeurs(), alpha, a, b);
+}
+
+/*! @brief resu += alpha * a (x) b, en ramenant a et b aux elements si leurs supports different.
+ *
+ */
+void Integrale_tps_produit_champs::ajoute_produit_tensoriel(DoubleTab& resu, double alpha, const Champ_base& a, const Champ_base& b) const
 {
   if (support_different_)
     {
@@ -93,15 +100,13 @@ void Integrale_tps_produit_champs::ajoute_produit_tensoriel(double alpha, const
       val_b.resize(nb_elem_tot,b.nb_comp());
       a.valeur_aux(xp, val_a);
       b.valeur_aux(xp, val_b);
-      valeurs().ajoute_produit_tensoriel(alpha,val_a,val_b);
-      valeurs().echange_espace_virtuel();
+      resu.ajoute_produit_tensoriel(alpha,val_a,val_b);
+      resu.echange_espace_virtuel();
     }
   else
     {
       const DoubleTab& val_a = a.valeurs();
       const DoubleTab& val_b = b.valeurs();
-      valeurs().ajoute_produit_tensoriel(alpha,val_a,val_b);
+      resu.ajoute_produit_tensoriel(alpha,val_a,val_b);
     }
 }
-
-
@@ -60,6 +60,7 @@ public:
   inline void mettre_a_jour(double ) override;
   void mettre_a_jour_integrale() override;
   void ajoute_produit_tensoriel(double, const Champ_base&, const Champ_base&);
+  void ajoute_produit_tensoriel(DoubleTab&, double, const Champ_base&, const Champ_base&) const;
 
 protected :
 
@@ -82,7 +83,7 @@ inline void Integrale_tps_produit_champs::mettre_a_jour(double )
 {
   mettre_a_jour_integrale();
   Champ espace_stockage_source;
-  const Champ_base& source = mon_champ->get_champ(espace_stockage_source);
+  const Champ_base& source = mon_champ->get_champ_memorise(espace_stockage_source);
   changer_temps(source.temps());
 }
 
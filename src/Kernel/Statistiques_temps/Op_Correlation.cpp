@@ -193,23 +193,26 @@ void Op_Correlation::completer(const Probleme_base& Pb)
       integrale_tps_ab_->fixer_unites(unites);
     }
   integrale_tps_ab_.changer_temps(Pb.schema_temps().temps_courant());
+
+  // Meme support : l'integrale de a*b est avancee dans le meme parcours que celle de la moyenne de a
+  if (!integrale_tps_ab_.get_support_different())
+    la_moyenne_a_->integrale().rattacher_produit(integrale_tps_ab_);
 }
 
-DoubleTab Op_Correlation::calculer_valeurs() const
+void Op_Correlation::calculer_valeurs(DoubleTab& correlation) const
 {
-  Integrale_tps_produit_champs correlation(integrale_tps_ab_);
+  correlation = integrale_tps_ab_.valeurs();
   const double dt_ab = dt_integration_ab();
   if ( dt_ab > 0 )
     {
       // On calcule Moyenne(a'b')=Moyenne(ab)-Moyenne(a)*Moyenne(b)
-      correlation.valeurs() /= dt_ab;
+      correlation /= dt_ab;
       const double dt_a = dt_integration_a();
       const double dt_b = dt_integration_b();
       assert(est_egal(dt_a,dt_ab));
       assert(est_egal(dt_b,dt_ab));
-      correlation.ajoute_produit_tensoriel(-1/(dt_a*dt_b),integrale_tps_a_.valeur().valeur(),integrale_tps_b_.valeur().valeur());
+      integrale_tps_ab_.ajoute_produit_tensoriel(correlation,-1/(dt_a*dt_b),integrale_tps_a_.valeur().valeur(),integrale_tps_b_.valeur().valeur());
     }
-  return correlation.valeurs();
 }
 
 int Op_Correlation::completer_post_statistiques(const Domaine& dom,const int is_axi,Format_Post_base& format)
@@ -50,7 +50,8 @@ public:
   inline int reprendre(Entree& is) override;
   inline void associer_op_stat(const Operateur_Statistique_tps_base&) override;
   void completer(const Probleme_base& ) override;
-  DoubleTab calculer_valeurs() const override;
+  void calculer_valeurs(DoubleTab& resu) const override;
+  using Operateur_Statistique_tps_base::calculer_valeurs;
 
 protected:
   REF(Op_Moyenne) la_moyenne_a_;
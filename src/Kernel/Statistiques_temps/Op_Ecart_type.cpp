@@ -72,9 +72,13 @@ void Op_Ecart_type::completer(const Probleme_base& Pb)
   else
     integrale_carre_champ->fixer_unites(source.unites());
   integrale_carre_champ->changer_temps(Pb.schema_temps().temps_courant());
+
+  // L'integrale du carre est avancee dans le meme parcours que celle de la moyenne
+  if (la_moyenne.non_nul())
+    la_moyenne->integrale().rattacher_carre(integrale_carre_champ);
 }
 
-DoubleTab Op_Ecart_type::calculer_valeurs() const
+void Op_Ecart_type::calculer_valeurs(DoubleTab& ecart_type) const
 {
   double dt = dt_integration();
   if (!est_egal(dt,dt_integration_carre()))
@@ -82,7 +86,7 @@ DoubleTab Op_Ecart_type::calculer_valeurs() const
       Cerr << "Not implemented yet in Op_Ecart_type::calculer_valeurs()" << finl;
       exit();
     }
-  DoubleTab ecart_type(valeurs_carre());
+  ecart_type = valeurs_carre();
   if ( dt > 0 )
     {
       ecart_type *= dt;                      // sum(I^2)*dt
@@ -91,5 +95,4 @@ DoubleTab Op_Ecart_type::calculer_valeurs() const
       ecart_type.abs();                      // To avoid negative number ?
       ecart_type.racine_carree();            // sqrt(mean(I^2)-mean(I)^2)
     }
-  return ecart_type;
 }
@@ -44,7 +44,8 @@ public:
   inline void fixer_tstat_fin(double ) override;
   inline void associer_op_stat(const Operateur_Statistique_tps_base& ) override;
   void completer(const Probleme_base& ) override;
-  DoubleTab calculer_valeurs() const override;
+  void calculer_valeurs(DoubleTab& resu) const override;
+  using Operateur_Statistique_tps_base::calculer_valeurs;
   inline int sauvegarder(Sortie& os) const override;
   inline int reprendre(Entree& is) override;
 
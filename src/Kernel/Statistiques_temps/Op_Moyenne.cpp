@@ -73,11 +73,10 @@ void Op_Moyenne::completer(const Probleme_base& Pb)
   integrale_champ->changer_temps(Pb.schema_temps().temps_courant());
 }
 
-DoubleTab Op_Moyenne::calculer_valeurs() const
+void Op_Moyenne::calculer_valeurs(DoubleTab& moyenne) const
 {
   double dt = dt_integration();
-  DoubleTab moyenne(valeurs());
+  moyenne = valeurs();
   if (dt > 0)
     moyenne /= dt;
-  return moyenne;
 }
@@ -42,6 +42,10 @@ public:
   {
     return integrale_champ;
   };
+  inline Integrale_tps_Champ& integrale()
+  {
+    return integrale_champ;
+  };
   inline const DoubleTab& valeurs() const
   {
     return integrale_champ.valeurs();
@@ -63,7 +67,8 @@ public:
   inline int sauvegarder(Sortie& os) const override;
   inline int reprendre(Entree& is) override;
   void completer(const Probleme_base& ) override;
-  DoubleTab calculer_valeurs() const override;
+  void calculer_valeurs(DoubleTab& resu) const override;
+  using Operateur_Statistique_tps_base::calculer_valeurs;
 
 protected:
 
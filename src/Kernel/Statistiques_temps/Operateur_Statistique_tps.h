@@ -45,6 +45,10 @@ public:
   {
     return valeur().calculer_valeurs();
   };
+  inline void calculer_valeurs(DoubleTab& resu) const
+  {
+    valeur().calculer_valeurs(resu);
+  };
   inline void mettre_a_jour(double un_temps)
   {
     valeur().mettre_a_jour(un_temps);
@@ -14,6 +14,7 @@
 *****************************************************************************/
 
 #include <Operateur_Statistique_tps_base.h>
+#include <TRUSTTab.h>
 
 Implemente_base(Operateur_Statistique_tps_base,"Operateur_Statistique_tps_base",Objet_U);
 
@@ -51,3 +52,13 @@ int Operateur_Statistique_tps_base::completer_post_statistiques(const Domaine& d
   return 1;
 
 }
+
+/*! @brief Renvoie une copie de la statistique. Preferer calculer_valeurs(DoubleTab&) pour remplir un tableau existant.
+ *
+ */
+DoubleTab Operateur_Statistique_tps_base::calculer_valeurs() const
+{
+  DoubleTab resu;
+  calculer_valeurs(resu);
+  return resu;
+}
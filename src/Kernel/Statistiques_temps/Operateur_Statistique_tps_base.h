@@ -54,7 +54,8 @@ public:
   virtual const Integrale_tps_Champ& integrale() const =0;
   virtual void initialiser(double val) =0;
   virtual void completer(const Probleme_base& ) =0;
-  virtual DoubleTab calculer_valeurs() const =0;
+  virtual void calculer_valeurs(DoubleTab& resu) const =0; // ecrit la statistique dans resu (pas de reallocation si resu a deja la bonne structure)
+  DoubleTab calculer_valeurs() const;
   virtual int completer_post_statistiques(const Domaine& dom,const int is_axi,Format_Post_base& format);
   inline double tstat_deb() const { return tstat_deb_; }
   inline double tstat_fin() const { return tstat_fin_; }
@@ -56,6 +56,8 @@ public:
   virtual void mp_collective_op(const float *x, float *resu, const Collective_Op *op, int n) const = 0;
   virtual void mp_collective_op(const int *x, int *resu, int n, Collective_Op op) const = 0;
   virtual void mp_collective_op(const int *x, int *resu, const Collective_Op *op, int n) const = 0;
+  // Version 64 bits pour les effectifs et numerotations globaux (trustIdType)
+  virtual void mp_collective_op(const long *x, long *resu, int n, Collective_Op op) const = 0;
   virtual void barrier(int tag) const = 0;
 
   // Calcule un nouveau tag de communication qui permet d'identifier les
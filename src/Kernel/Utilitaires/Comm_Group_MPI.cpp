@@ -17,10 +17,8 @@
 #include <PE_Groups.h>
 #include <stat_counters.h>
 #include <Statistiques.h>
-#include <vector>
-#ifdef INT_is_64_
 #include <algorithm>
-#endif
+#include <vector>
 
 
 Implemente_instanciable_sans_constructeur_ni_destructeur(Comm_Group_MPI,"Comm_Group_MPI",Comm_Group);
@@ -38,6 +36,11 @@ int Comm_Group_MPI::mpi_nrequests_ = -1;
 int Comm_Group_MPI::mpi_maxrequests_ = -1;
 int Comm_Group_MPI::current_msg_size_;
 MPI_Comm Comm_Group_MPI::trio_u_world_ = MPI_COMM_WORLD;
+MPI_Comm Comm_Group_MPI::noeud_comm_ = MPI_COMM_NULL;
+MPI_Comm Comm_Group_MPI::leaders_comm_ = MPI_COMM_NULL;
+bool Comm_Group_MPI::reductions_hierarchiques_ = false;
+MPI_Op Comm_Group_MPI::op_somme_max_ = MPI_OP_NULL;
+std::map<int, MPI_Datatype> Comm_Group_MPI::types_somme_max_;
 // By default, we initialize mpi at statup (see set_must_mpi_initialize())
 int Comm_Group_MPI::must_mpi_initialize_ = 1;
 /*! @brief Partie non inline du traitement d'erreur mpi.
@@ -168,17 +171,17 @@ void Comm_Group_MPI::mp_collective_op(const double *x, double *resu, int n, Coll
       // (x ne sera jamais modifie par la librairie, sauf bug !)
     case COLL_SUM:
       statistiques().begin_count(mpi_sumdouble_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_DOUBLE, MPI_SUM, mpi_comm_));
+      allreduce_(x, resu, n, MPI_DOUBLE, MPI_SUM);
       statistiques().end_count(mpi_sumdouble_counter_);
       break;
     case COLL_MIN:
       statistiques().begin_count(mpi_mindouble_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_DOUBLE, MPI_MIN, mpi_comm_));
+      allreduce_(x, resu, n, MPI_DOUBLE, MPI_MIN);
       statistiques().end_count(mpi_mindouble_counter_);
       break;
     case COLL_MAX:
       statistiques().begin_count(mpi_maxdouble_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_DOUBLE, MPI_MAX, mpi_comm_));
+      allreduce_(x, resu, n, MPI_DOUBLE, MPI_MAX);
       statistiques().end_count(mpi_maxdouble_counter_);
       break;
     case COLL_PARTIAL_SUM:
@@ -209,17 +212,17 @@ void Comm_Group_MPI::mp_collective_op(const float *x, float *resu, int n, Collec
       // (x ne sera jamais modifie par la librairie, sauf bug !)
     case COLL_SUM:
       statistiques().begin_count(mpi_sumfloat_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_FLOAT, MPI_SUM, mpi_comm_));
+      allreduce_(x, resu, n, MPI_FLOAT, MPI_SUM);
       statistiques().end_count(mpi_sumfloat_counter_);
       break;
     case COLL_MIN:
       statistiques().begin_count(mpi_minfloat_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_FLOAT, MPI_MIN, mpi_comm_));
+      allreduce_(x, resu, n, MPI_FLOAT, MPI_MIN);
       statistiques().end_count(mpi_minfloat_counter_);
       break;
     case COLL_MAX:
       statistiques().begin_count(mpi_maxfloat_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_FLOAT, MPI_MAX, mpi_comm_));
+      allreduce_(x, resu, n, MPI_FLOAT, MPI_MAX);
       statistiques().end_count(mpi_maxfloat_counter_);
       break;
     case COLL_PARTIAL_SUM:
@@ -250,21 +253,28 @@ void Comm_Group_MPI::mp_collective_op(const int *x, int *resu, int n, Collective
       // (x ne sera jamais modifie par la librairie, sauf bug !)
     case COLL_SUM:
       statistiques().begin_count(mpi_sumint_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_ENTIER, MPI_SUM, mpi_comm_));
+      allreduce_(x, resu, n, MPI_ENTIER, MPI_SUM);
       statistiques().end_count(mpi_sumint_counter_);
       break;
     case COLL_MIN:
       statistiques().begin_count(mpi_minint_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_ENTIER, MPI_MIN, mpi_comm_));
+      allreduce_(x, resu, n, MPI_ENTIER, MPI_MIN);
       statistiques().end_count(mpi_minint_counter_);
       break;
     case COLL_MAX:
       statistiques().begin_count(mpi_maxint_counter_);
-      mpi_error(MPI_Allreduce((int*) x, resu, n, MPI_ENTIER, MPI_MAX, mpi_comm_));
+      allreduce_(x, resu, n, MPI_ENTIER, MPI_MAX);
       statistiques().end_count(mpi_maxint_counter_);
       break;
     case COLL_PARTIAL_SUM:
-      internal_collective(x, resu, n, &op, -1 /* only one operation */, 0 /* recursion level */);
+      // Somme partielle exclusive de tout le tableau en un seul appel (et non element par element)
+      statistiques().begin_count(mpi_partialsum_counter_);
+      mpi_error(MPI_Exscan((int*) x, resu, n, MPI_ENTIER, MPI_SUM, mpi_comm_));
+      statistiques().end_count(mpi_partialsum_counter_);
+      // Le resultat de MPI_Exscan est indefini sur le rang 0
+      if (rank() == 0)
+        for (int i = 0; i < n; i++)
+          resu[i] = 0;
       break;
     }
 #endif
@@ -279,6 +289,44 @@ void Comm_Group_MPI::mp_collective_op(const int *x, int *resu, const Collective_
 #endif
 }
 
+/*! @brief Operation collective sur des entiers 64 bits (effectifs et numerotations globaux, voir trustIdType).
+ *
+ */
+void Comm_Group_MPI::mp_collective_op(const long *x, long *resu, int n, Collective_Op op) const
+{
+#ifdef MPI_
+  if (n <= 0)
+    return;
+  switch(op)
+    {
+    case COLL_SUM:
+      statistiques().begin_count(mpi_sumint_counter_);
+      allreduce_(x, resu, n, MPI_LONG, MPI_SUM);
+      statistiques().end_count(mpi_sumint_counter_);
+      break;
+    case COLL_MIN:
+      statistiques().begin_count(mpi_minint_counter_);
+      allreduce_(x, resu, n, MPI_LONG, MPI_MIN);
+      statistiques().end_count(mpi_minint_counter_);
+      break;
+    case COLL_MAX:
+      statistiques().begin_count(mpi_maxint_counter_);
+      allreduce_(x, resu, n, MPI_LONG, MPI_MAX);
+      statistiques().end_count(mpi_maxint_counter_);
+      break;
+    case COLL_PARTIAL_SUM:
+      statistiques().begin_count(mpi_partialsum_counter_);
+      mpi_error(MPI_Exscan((long*) x, resu, n, MPI_LONG, MPI_SUM, mpi_comm_));
+      statistiques().end_count(mpi_partialsum_counter_);
+      // Le resultat de MPI_Exscan est indefini sur le rang 0
+      if (rank() == 0)
+        for (int i = 0; i < n; i++)
+          resu[i] = 0;
+      break;
+    }
+#endif
+}
+
 /*! @brief Point de synchronisation de tous les processeurs du groupe (permet de verifier que tout le monde est la.
  *
  * ..). Si check_enabled() est
@@ -560,12 +608,14 @@ void Comm_Group_MPI::init_group_trio()
       must_finalize_ = 1;
       True_int argc=0;
       char** argv=nullptr;
-      int errcode = MPI_Init(&argc, &argv);
+      // MPI_THREAD_FUNNELED: seul le thread principal communique (mode hybride MPI+threads)
+      True_int niveau_fourni;
+      int errcode = MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &niveau_fourni);
       //int errcode = MPI_Init(0,0); Message d'erreur sur MPI Voltaire
       if (errcode != MPI_SUCCESS)
         {
           Cerr << "Error in Comm_Group_MPI::init_group_trio()\n"
-               << " MPI_Init() failed (forget to run with mpirun ?)" << finl;
+               << " MPI_Init_thread() failed (forget to run with mpirun ?)" << finl;
           mpi_error(errcode);
         }
     }
@@ -592,6 +642,8 @@ void Comm_Group_MPI::init_group_trio()
     {
       mpi_requests_[r]=MPI_REQUEST_NULL;
     }
+  init_reductions_hierarchiques();
+
   if (arank == 0)
     {
       if (trio_u_world_ == MPI_COMM_WORLD)
@@ -606,11 +658,71 @@ void Comm_Group_MPI::init_group_trio()
 }
 
 
+/*! @brief Construit les communicateurs des reductions hierarchiques sur le groupe TRUST global:
+ *
+ *  noeud_comm_ regroupe les processeurs d'un meme noeud (memoire partagee), leaders_comm_ les processeurs de rang 0
+ *  de chaque noeud. Le mode n'est active que s'il y a plusieurs noeuds et plusieurs processeurs sur au moins l'un d'eux
+ *  (sinon il n'apporte rien). La variable d'environnement TRUST_FLAT_COLLECTIVES conserve les reductions a plat.
+ *  noeud_comm_ est construit dans tous les cas (il sert aussi a Memoire_Partagee_Noeud).
+ */
+void Comm_Group_MPI::init_reductions_hierarchiques()
+{
+  reductions_hierarchiques_ = false;
+  True_int rang, rang_noeud, taille_noeud, est_leader, nb_noeuds, taille_noeud_max;
+  mpi_error(MPI_Comm_rank(mpi_comm_, &rang));
+  mpi_error(MPI_Comm_split_type(mpi_comm_, MPI_COMM_TYPE_SHARED, rang, MPI_INFO_NULL, &noeud_comm_));
+  mpi_error(MPI_Comm_rank(noeud_comm_, &rang_noeud));
+  mpi_error(MPI_Comm_size(noeud_comm_, &taille_noeud));
+  est_leader = (rang_noeud == 0);
+  mpi_error(MPI_Allreduce(&est_leader, &nb_noeuds, 1, MPI_INT, MPI_SUM, mpi_comm_));
+  mpi_error(MPI_Allreduce(&taille_noeud, &taille_noeud_max, 1, MPI_INT, MPI_MAX, mpi_comm_));
+  mpi_error(MPI_Comm_split(mpi_comm_, est_leader ? 0 : MPI_UNDEFINED, rang, &leaders_comm_));
+  reductions_hierarchiques_ = (nb_noeuds > 1 && taille_noeud_max > 1 && getenv("TRUST_FLAT_COLLECTIVES") == nullptr);
+  if (rang == 0 && reductions_hierarchiques_)
+    Cerr << "Small collective reductions are hierarchical: " << (int)nb_noeuds << " nodes, up to " << (int)taille_noeud_max
+         << " processors per node (set TRUST_FLAT_COLLECTIVES to disable)." << finl;
+}
+
+/*! @brief MPI_Allreduce sur le communicateur du groupe.
+ *
+ *  Sur le groupe TRUST global, et pour les petits messages (limites par la latence et le debit de messages de la carte
+ *  reseau), la reduction est faite en deux niveaux: reduction sur le leader de chaque noeud par memoire partagee,
+ *  MPI_Allreduce entre leaders, puis diffusion dans le noeud. Un seul message par noeud transite ainsi sur le reseau.
+ */
+void Comm_Group_MPI::allreduce_(const void *x, void *resu, int n, MPI_Datatype type, MPI_Op op) const
+{
+  // Cast en non const a cause de l'interface de MPI (x ne sera jamais modifie par la librairie)
+  void *src = (void *) x;
+  if (!reductions_hierarchiques_ || mpi_comm_ != trio_u_world_ || n > TAILLE_MAX_REDUCTION_HIERARCHIQUE)
+    {
+      mpi_error(MPI_Allreduce(src, resu, (True_int) n, type, op, mpi_comm_));
+      return;
+    }
+  const bool leader = (leaders_comm_ != MPI_COMM_NULL);
+  mpi_error(MPI_Reduce((leader && x == resu) ? MPI_IN_PLACE : src, resu, (True_int) n, type, op, 0, noeud_comm_));
+  if (leader)
+    mpi_error(MPI_Allreduce(MPI_IN_PLACE, resu, (True_int) n, type, op, leaders_comm_));
+  mpi_error(MPI_Bcast(resu, (True_int) n, type, 0, noeud_comm_));
+}
+
 // MPI_Group_free should be done before MPI_Finalize so not included into Comm_Group_MPI destructor
 void Comm_Group_MPI::free()
 {
   if (mpi_maxrequests_!=-1) // Group is created when mpi_maxrequests_>0 (avoid a crash with verifie_pere script)
     mpi_error(MPI_Group_free(& mpi_group_));
+  if (mpi_comm_ == trio_u_world_)
+    {
+      if (noeud_comm_ != MPI_COMM_NULL)
+        mpi_error(MPI_Comm_free(& noeud_comm_));
+      if (leaders_comm_ != MPI_COMM_NULL)
+        mpi_error(MPI_Comm_free(& leaders_comm_));
+      reductions_hierarchiques_ = false;
+      for (auto& it : types_somme_max_)
+        mpi_error(MPI_Type_free(& it.second));
+      types_somme_max_.clear();
+      if (op_somme_max_ != MPI_OP_NULL)
+        mpi_error(MPI_Op_free(& op_somme_max_));
+    }
 }
 
 // Wrapper to MPI_Alltoallv. data type is MPI_CHAR
@@ -770,20 +882,86 @@ void Comm_Group_MPI::internal_collective(const int *x, int *resu, int nx, const
     }
 }
 
+/*! @brief Operation MPI de la reduction fusionnee somme/max (voir internal_collective pour double).
+ *
+ * Chaque element du type contigu contient { nb_sommes, sommes..., max... } : les nb_sommes premieres valeurs
+ *  sont sommees, les suivantes sont reduites par max (les min y sont passes sous forme de max de l'oppose).
+ */
+static void reduction_somme_max(void *in, void *inout, True_int *len, MPI_Datatype *type)
+{
+  True_int taille;
+  MPI_Type_size(*type, &taille);
+  const int n = taille / (True_int)sizeof(double);
+  const double *x = (const double *) in;
+  double *y = (double *) inout;
+  for (True_int k = 0; k < *len; k++, x += n, y += n)
+    {
+      const int nb_sommes = (int) x[0];
+      for (int i = 1; i <= nb_sommes; i++)
+        y[i] += x[i];
+      for (int i = nb_sommes + 1; i < n; i++)
+        y[i] = std::max(y[i], x[i]);
+    }
+}
+
 void Comm_Group_MPI::internal_collective(const double *x, double *resu, int nx, const Collective_Op *op, int nop, int level) const
 {
-  // Pour l'instant algo bourrin, a optimiser...
+  if (nop < 0 || nx == 1)
+    {
+      for (int i = 0; i < nx; i++)
+        {
+          if (op[nop < 0 ? 0 : i] == COLL_PARTIAL_SUM)
+            {
+              Cerr << "Error in Comm_Group_MPI: COLL_PARTIAL_SUM not coded for double" << finl;
+              exit();
+            }
+          mp_collective_op(x+i, resu+i, 1, op[nop < 0 ? 0 : i]);
+        }
+      return;
+    }
+  // Operations differentes: un seul MPI_Allreduce sur un type contigu { nb_sommes, sommes..., max... }
+  // (le type contigu garantit que MPI ne decoupe pas le tampon, l'operation connait ainsi la separation sommes/max)
+  int nb_sommes = 0;
   for (int i = 0; i < nx; i++)
     {
-      int j = (nop < 0) ? 0 : i;
-      if (op[j] != COLL_PARTIAL_SUM)
-        mp_collective_op(x+i, resu+i, 1, op[j]);
-      else
+      if (op[i] == COLL_PARTIAL_SUM)
         {
           Cerr << "Error in Comm_Group_MPI: COLL_PARTIAL_SUM not coded for double" << finl;
           exit();
         }
+      if (op[i] == COLL_SUM) nb_sommes++;
     }
+  std::vector<double> tampon(nx + 1), tampon_resu(nx + 1);
+  tampon[0] = nb_sommes;
+  for (int i = 0, i_somme = 1, i_max = nb_sommes + 1; i < nx; i++)
+    if (op[i] == COLL_SUM)
+      tampon[i_somme++] = x[i];
+    else
+      tampon[i_max++] = (op[i] == COLL_MIN) ? -x[i] : x[i];
+
+  // L'operation et le type contigu (un par taille nx) sont crees au premier usage et gardes jusqu'a free()
+  if (op_somme_max_ == MPI_OP_NULL)
+    mpi_error(MPI_Op_create(&reduction_somme_max, 1 /* commutative */, &op_somme_max_));
+  auto it = types_somme_max_.find(nx);
+  if (it == types_somme_max_.end())
+    {
+      MPI_Datatype type;
+      mpi_error(MPI_Type_contiguous((True_int)(nx + 1), MPI_DOUBLE, &type));
+      mpi_error(MPI_Type_commit(&type));
+      it = types_somme_max_.emplace(nx, type).first;
+    }
+  statistiques().begin_count(mpi_sumdouble_counter_);
+  allreduce_(tampon.data(), tampon_resu.data(), 1, it->second, op_somme_max_);
+  statistiques().end_count(mpi_sumdouble_counter_);
+
+  for (int i = 0, i_somme = 1, i_max = nb_sommes + 1; i < nx; i++)
+    if (op[i] == COLL_SUM)
+      resu[i] = tampon_resu[i_somme++];
+    else
+      {
+        const double v = tampon_resu[i_max++];
+        resu[i] = (op[i] == COLL_MIN) ? -v : v;
+      }
 }
 
 void Comm_Group_MPI::internal_collective(const float *x, float *resu, int nx, const Collective_Op *op, int nop, int level) const
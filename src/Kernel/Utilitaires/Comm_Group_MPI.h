@@ -18,6 +18,7 @@
 
 #include <Comm_Group_Noparallel.h>
 #include <TRUST_Ref.h>
+#include <map>
 
 class Comm_Group;
 
@@ -48,6 +49,7 @@ public:
   void mp_collective_op(const float *x, float *resu, const Collective_Op *op, int n) const override;
   void mp_collective_op(const int *x, int *resu, int n, Collective_Op op) const override;
   void mp_collective_op(const int *x, int *resu, const Collective_Op *op, int n) const override;
+  void mp_collective_op(const long *x, long *resu, int n, Collective_Op op) const override;
 
   void barrier(int tag) const override;
   void send_recv_start(const ArrOfInt& send_list,
@@ -73,6 +75,7 @@ public:
                    void *dest_buffer, int *recv_data_size, int *recv_data_offset) const;
   static void set_trio_u_world(MPI_Comm world);
   static MPI_Comm get_trio_u_world();
+  static MPI_Comm get_noeud_comm() { return noeud_comm_; } // processeurs du meme noeud que moi dans le groupe TRUST global
   static void set_must_mpi_initialize(int flag);
 
   void ptop_send_recv(const void * send_buf, int send_buf_size, int send_proc,
@@ -86,6 +89,11 @@ protected:
   void internal_collective(const double *x, double *resu, int nx, const Collective_Op *op, int nop, int level) const;
   void internal_collective(const float *x, float *resu, int nx, const Collective_Op *op, int nop, int level) const;
   int  mppartial_sum(int x) const;
+  void allreduce_(const void *x, void *resu, int n, MPI_Datatype type, MPI_Op op) const;
+  void init_reductions_hierarchiques();
+
+  // Au dela de cette taille, la reduction est limitee par le debit et MPI_Allreduce a plat est conserve
+  static constexpr int TAILLE_MAX_REDUCTION_HIERARCHIQUE = 256;
 
 private:
   // Voir set_must_mpi_initialize() et init_group_trio()
@@ -98,6 +106,13 @@ private:
   static int mpi_nrequests_;
   static int mpi_maxrequests_;
   static int current_msg_size_; // La taille des donnees envoyees/recues pour le send_recv_start courant
+  // Reductions hierarchiques sur le groupe TRUST global (voir init_reductions_hierarchiques())
+  static MPI_Comm noeud_comm_;   // processeurs du meme noeud
+  static MPI_Comm leaders_comm_; // processeurs de rang 0 de chaque noeud (MPI_COMM_NULL ailleurs)
+  static bool reductions_hierarchiques_;
+  // Reduction fusionnee somme/max de internal_collective(double): operation et types contigus par taille, liberes dans free()
+  static MPI_Op op_somme_max_;
+  static std::map<int, MPI_Datatype> types_somme_max_;
 
   MPI_Group mpi_group_;// Handle sur le groupe mpi
   MPI_Comm  mpi_comm_; // Handle sur le communicateur mpi
@@ -32,6 +32,7 @@ public:
   void mp_collective_op(const float *x, float *resu, const Collective_Op *op, int n) const override { mp_collective_op_template<float>(x,resu,op,n); }
   void mp_collective_op(const int *x, int *resu, int n, Collective_Op op) const override { mp_collective_op_template<int>(x,resu,n,op); }
   void mp_collective_op(const int *x, int *resu, const Collective_Op *op, int n) const override { mp_collective_op_template<int>(x,resu,op,n); }
+  void mp_collective_op(const long *x, long *resu, int n, Collective_Op op) const override { mp_collective_op_template<long>(x,resu,n,op); }
 
   void barrier(int tag) const override;
   int reverse_send_recv_list(const ArrOfInt& src_list, ArrOfInt& dest_list) const;
@@ -245,7 +245,8 @@ int EcrFicPartageMPIIO::put(MPI_Datatype MPI_TYPE, const void* ob, int n)
 
   // Before collecting operations, update disp_ on all processes:
   envoyer_broadcast(disp_, 0);
-  MPI_Offset disp_me = disp_ + mppartial_sum(n) * sizeof_etype;
+  // Position calculee sur 64 bits : le total ecrit par les processeurs precedents peut depasser 2^31 etype
+  MPI_Offset disp_me = disp_ + (MPI_Offset) Process::mppartial_sum_as_long(n) * sizeof_etype;
   // ROMIO hints:
   if (Process::nproc()>1024)
     {
@@ -14,6 +14,7 @@
 *****************************************************************************/
 
 #include <LecFicDiffuse_JDD.h>
+#include <communications_array.h>
 #include <communications.h>
 #include <EFichier.h>
 #include <SChaine.h>
@@ -69,6 +70,8 @@ int LecFicDiffuse_JDD::ouvrir(const char* name,
                               IOS_OPEN_MODE mode)
 {
   int ok = 0;
+  lecture_locale_ = false;
+  std::string contenu;
   if(Process::je_suis_maitre())
     {
       Cout <<"Reading data file "<<finl;
@@ -214,12 +217,24 @@ int LecFicDiffuse_JDD::ouvrir(const char* name,
           Process::exit();
         }
 
-      chaine_.init(prov.get_str());
+      contenu = prov.get_str();
       Cout <<finl;
 
       Process::Journal()<<"JDD interpreted: "<<finl<<prov.get_str()<<finl<<finl;
     }
   envoyer_broadcast(ok, 0);
+  if (ok)
+    {
+      // Le jeu de donnees pretraite est diffuse en une seule fois : chaque processeur
+      // lit ensuite sa propre copie, sans communication a chaque mot lu.
+      int taille = (int)contenu.size();
+      envoyer_broadcast(taille, 0);
+      contenu.resize(taille);
+      if (taille > 0)
+        envoyer_broadcast_array(&contenu[0], taille, 0);
+      chaine_.init(contenu.c_str());
+      lecture_locale_ = true;
+    }
   return ok;
 }
 
@@ -23,15 +23,15 @@ class Objet_U;
 
 /*! @brief Cette classe implemente les operateurs et les methodes virtuelles de la classe EFichier de la facon suivante : Le fichier a lire est physiquement localise sur le disque de la machine hebergeant la tache maitre de l'application Trio-U (le processus de rang 0 dans le groupe "tous")
  *
- *     et chaque item lu dans ce fichier est diffuse a tous les autres processus du groupe tous.
- *     Il en est de meme pour les methodes d'inspection de l'etat d'un fichier.
+ *     qui le pretraite (commentaires, verifications) puis diffuse en une seule fois le texte obtenu
+ *     a tous les autres processus du groupe. Chaque processus lit ensuite sa copie locale.
  *
  */
 
 class LecFicDiffuse_JDD : public Lec_Diffuse_base
 {
   Declare_instanciable_sans_constructeur(LecFicDiffuse_JDD);
-  // le maitre lit le fichier et propage l'information
+  // le maitre lit le fichier et diffuse son contenu pretraite
 public:
   LecFicDiffuse_JDD();
   LecFicDiffuse_JDD(const char* name, IOS_OPEN_MODE mode=ios::in, bool apply_verification=true);
@@ -62,7 +62,7 @@ int Lec_Diffuse_base::get(double *ob, int n) { return get_template<double>(ob, n
 int Lec_Diffuse_base::get(char *buf, int bufsize)
 {
   int l = -1;
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       assert(is.get_error_action() == ERROR_CONTINUE);
@@ -75,7 +75,7 @@ int Lec_Diffuse_base::get(char *buf, int bufsize)
       Cerr << "Lec_Diffuse_base::get(...) can't be used with diffuse_=0 on non master process." << finl;
       Process::exit();
     }
-  if (diffuse_)
+  if (diffuse_ && !lecture_locale_)
     {
       envoyer_broadcast(l, 0);
       if (l > 0)
@@ -87,36 +87,36 @@ int Lec_Diffuse_base::get(char *buf, int bufsize)
 int Lec_Diffuse_base::eof()
 {
   int flag = 0;
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       flag = is.eof();
     }
-  if (diffuse_) envoyer_broadcast(flag, 0);
+  if (diffuse_ && !lecture_locale_) envoyer_broadcast(flag, 0);
   return flag;
 }
 
 int Lec_Diffuse_base::good()
 {
   int flag = 0;
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       flag = is.good();
     }
-  if (diffuse_) envoyer_broadcast(flag, 0);
+  if (diffuse_ && !lecture_locale_) envoyer_broadcast(flag, 0);
   return flag;
 }
 
 int Lec_Diffuse_base::fail()
 {
   int flag = 0;
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       flag = is.fail();
     }
-  if (diffuse_) envoyer_broadcast(flag, 0);
+  if (diffuse_ && !lecture_locale_) envoyer_broadcast(flag, 0);
   return flag;
 }
 
@@ -127,12 +127,12 @@ int Lec_Diffuse_base::fail()
  */
 int Lec_Diffuse_base::set_bin(int bin)
 {
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       bin = is.set_bin(bin);
     }
-  if (diffuse_) envoyer_broadcast(bin, 0);
+  if (diffuse_ && !lecture_locale_) envoyer_broadcast(bin, 0);
   Entree::set_bin(bin);
   return bin;
 }
@@ -23,6 +23,8 @@
 /*! @brief Classe de base des entrees diffusees: le processeur maitre lit les donnees dans la classe get_entree_master() et les diffuse
  *
  *    sur tous les processeurs.
+ *    Si une classe derivee a deja diffuse tout le contenu de l'entree (lecture_locale_ vrai), chaque processeur
+ *    lit sa propre copie et aucune diffusion n'est faite mot par mot.
  *    Attention, les methodes operator>>(), get(), eof(), good() et bad()
  *    doivent etre appelees simultanement sur tous les processeurs.
  *    Les classes derivees doivent reimplementer get_entree_master().
@@ -69,6 +71,9 @@ protected:
   Lec_Diffuse_base(const Lec_Diffuse_base&) = default;
   Lec_Diffuse_base& operator=(const Lec_Diffuse_base&);
   virtual Entree& get_entree_master() = 0;
+  // Si vrai, chaque processeur dispose d'une copie locale de l'entree (get_entree_master() valide partout) :
+  // la lecture se fait alors sans aucune communication.
+  bool lecture_locale_ = false;
 
 private:
   template <typename _TYPE_>
@@ -82,7 +87,7 @@ template <typename _TYPE_>
 int Lec_Diffuse_base::get_template(_TYPE_ *ob, int n)
 {
   int ok = 0;
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       assert(is.get_error_action() == ERROR_CONTINUE);
@@ -93,7 +98,7 @@ int Lec_Diffuse_base::get_template(_TYPE_ *ob, int n)
       Cerr << "Lec_Diffuse_base::get(...) can't be used with diffuse_=0 on non master process." << finl;
       Process::exit();
     }
-  if (diffuse_)
+  if (diffuse_ && !lecture_locale_)
     {
       envoyer_broadcast(ok, 0);
       if (ok)
@@ -106,7 +111,7 @@ template <typename _TYPE_>
 Entree& Lec_Diffuse_base::operator_template(_TYPE_& ob)
 {
   int ok = 0;
-  if (Process::je_suis_maitre())
+  if (Process::je_suis_maitre() || lecture_locale_)
     {
       Entree& is = get_entree_master();
       assert(is.get_error_action() == ERROR_CONTINUE);
@@ -118,7 +123,7 @@ Entree& Lec_Diffuse_base::operator_template(_TYPE_& ob)
       Cerr << "Lec_Diffuse_base::operator>> can't be used with diffuse_=0 on non master process." << finl;
       Process::exit();
     }
-  if (diffuse_)
+  if (diffuse_ && !lecture_locale_)
     {
       envoyer_broadcast(ok, 0);
       if (ok)
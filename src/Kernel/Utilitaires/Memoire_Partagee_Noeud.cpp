@@ -0,0 +1,158 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#include <Memoire_Partagee_Noeud.h>
+#include <Comm_Group_MPI.h>
+#include <PE_Groups.h>
+#include <string.h>
+#include <typeinfo>
+#include <string>
+#include <map>
+
+#ifdef MPI_
+// Un segment par contenu distinct (cle = type, taille et empreinte des valeurs), libere par liberer()
+struct Segment_Partage
+{
+  MPI_Win win;
+  void *ptr;
+  size_t taille; // en octets
+  unsigned long long empreinte;
+};
+static std::map<std::string, Segment_Partage> segments_partages_;
+
+// Empreinte FNV-1a d'une zone memoire
+static unsigned long long empreinte_fnv(const void *ptr, size_t taille)
+{
+  unsigned long long empreinte = 14695981039346656037ULL;
+  const unsigned char *octets = static_cast<const unsigned char *>(ptr);
+  for (size_t i = 0; i < taille; i++)
+    empreinte = (empreinte ^ octets[i]) * 1099511628211ULL;
+  return empreinte;
+}
+#endif
+// 0 : pas encore initialise, 1 : actif, -1 : inactif
+static int etat_memoire_partagee_ = 0;
+
+/*! @brief Indique (decision prise au premier appel) si le partage est utile :
+ *
+ *   parallele MPI, groupe TRUST courant, et au moins un noeud portant plusieurs processeurs.
+ *   Le communicateur du noeud est celui des reductions hierarchiques (Comm_Group_MPI::get_noeud_comm()).
+ *   La decision est la meme sur tous les processeurs.
+ *
+ */
+bool Memoire_Partagee_Noeud::actif()
+{
+#ifdef MPI_
+  if (&PE_Groups::current_group() != &PE_Groups::groupe_TRUST())
+    return false;
+  if (etat_memoire_partagee_ == 0)
+    {
+      etat_memoire_partagee_ = -1;
+      if (Process::is_parallel() && getenv("TRUST_DISABLE_NODE_SHARED_MEMORY") == nullptr && sub_type(Comm_Group_MPI, PE_Groups::groupe_TRUST())
+          && Comm_Group_MPI::get_noeud_comm() != MPI_COMM_NULL)
+        {
+          True_int nb_rangs_noeud;
+          MPI_Comm_size(Comm_Group_MPI::get_noeud_comm(), &nb_rangs_noeud);
+          const int nb_rangs_max = Process::mp_max((int)nb_rangs_noeud);
+          if (nb_rangs_max > 1)
+            {
+              etat_memoire_partagee_ = 1;
+              Cerr << "Node shared memory enabled for large read-only arrays (up to " << nb_rangs_max << " ranks per node)." << finl;
+            }
+        }
+    }
+  return etat_memoire_partagee_ == 1;
+#else
+  return false;
+#endif
+}
+
+void Memoire_Partagee_Noeud::partager(TRUSTArray<double>& tab) { partager_(tab); }
+void Memoire_Partagee_Noeud::partager(TRUSTArray<int>& tab) { partager_(tab); }
+
+template <typename _TYPE_>
+void Memoire_Partagee_Noeud::partager_(TRUSTArray<_TYPE_>& tab)
+{
+  const int n = tab.size_array();
+  if (n < TAILLE_MIN || !actif())
+    return;
+#ifdef MPI_
+  // Empreinte FNV-1a du contenu : identique sur tous les processeurs si les donnees le sont
+  const size_t taille = n * sizeof(_TYPE_);
+  const unsigned long long empreinte = empreinte_fnv(tab.addr(), taille);
+  const std::string cle = std::string(typeid(_TYPE_).name()) + "_" + std::to_string(n) + "_" + std::to_string(empreinte);
+  auto it = segments_partages_.find(cle);
+
+  // Une seule reduction collective : min(h) et min(~h) donnent le min et le max des empreintes (les donnees doivent etre
+  // les memes partout), et le troisieme terme vaut 0 si un segment de meme cle existe deja mais avec un contenu different
+  // de tab sur un processeur (collision d'empreinte, detectee par comparaison locale avant de faire pointer tab dessus).
+  const MPI_Comm& comm = ref_cast(Comm_Group_MPI, PE_Groups::groupe_TRUST()).get_mpi_comm();
+  unsigned long long local[3] = { empreinte, ~empreinte, 1ULL }, global[3];
+  if (it != segments_partages_.end() && memcmp(it->second.ptr, tab.addr(), taille) != 0)
+    local[2] = 0ULL;
+  MPI_Allreduce(local, global, 3, MPI_UNSIGNED_LONG_LONG, MPI_MIN, comm);
+  if (global[0] != ~global[1])
+    {
+      Cerr << "Memoire_Partagee_Noeud::partager : array differs between processes, it is not shared." << finl;
+      return;
+    }
+  if (global[2] == 0ULL)
+    {
+      Cerr << "Memoire_Partagee_Noeud::partager : fingerprint collision with an already shared array, the array is not shared." << finl;
+      return;
+    }
+
+  if (it == segments_partages_.end())
+    {
+      True_int rang_noeud;
+      const MPI_Comm comm_noeud = Comm_Group_MPI::get_noeud_comm();
+      MPI_Comm_rank(comm_noeud, &rang_noeud);
+      const MPI_Aint taille_locale = (rang_noeud == 0) ? (MPI_Aint)taille : 0;
+      Segment_Partage segment;
+      segment.taille = taille;
+      segment.empreinte = empreinte;
+      void *base = nullptr;
+      MPI_Win_allocate_shared(taille_locale, sizeof(_TYPE_), MPI_INFO_NULL, comm_noeud, &base, &segment.win);
+      MPI_Aint taille_segment;
+      True_int unite;
+      MPI_Win_shared_query(segment.win, 0, &taille_segment, &unite, &segment.ptr);
+      MPI_Win_fence(0, segment.win);
+      if (rang_noeud == 0)
+        memcpy(segment.ptr, tab.addr(), taille);
+      MPI_Win_fence(0, segment.win);
+      it = segments_partages_.emplace(cle, segment).first;
+    }
+  // La copie privee est liberee, tab pointe sur la copie du noeud:
+  tab.ref_data(static_cast<_TYPE_ *>(it->second.ptr), n);
+#endif
+}
+
+/*! @brief Liberation des fenetres partagees, a appeler sur tous les processeurs avant Comm_Group_MPI::free() et MPI_Finalize.
+ *
+ *   En debug, on verifie que le contenu des segments n'a pas ete modifie pendant le calcul (les tableaux partages sont en lecture seule).
+ *
+ */
+void Memoire_Partagee_Noeud::liberer()
+{
+#ifdef MPI_
+  for (auto& it : segments_partages_)
+    {
+      assert(empreinte_fnv(it.second.ptr, it.second.taille) == it.second.empreinte);
+      MPI_Win_free(&it.second.win);
+    }
+  segments_partages_.clear();
+#endif
+  etat_memoire_partagee_ = 0;
+}
@@ -0,0 +1,48 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#ifndef Memoire_Partagee_Noeud_included
+#define Memoire_Partagee_Noeud_included
+
+#include <TRUSTArray.h>
+
+/*! @brief Allocation de tableaux en lecture seule dans une fenetre MPI-3 partagee par tous les processeurs d'un meme noeud.
+ *
+ *  partager(tab) est collectif sur le groupe courant (qui doit etre le groupe TRUST) et doit etre appele avec un tableau
+ *  identique sur tous les processeurs (donnees lues du jeu de donnees par exemple). Le processeur de rang 0 du noeud
+ *  recopie les valeurs dans la fenetre, puis tous les processeurs font pointer tab (ref_data) sur cette copie unique:
+ *  la copie privee est liberee. Deux tableaux de meme contenu partagent le meme segment (deduplication par noeud).
+ *
+ *  Le tableau est ensuite en lecture seule : un redimensionnement est refuse (tableau ref_data), une ecriture modifierait la
+ *  copie de tous les processeurs du noeud et de tous les tableaux de meme contenu. En debug, liberer() verifie par l'empreinte
+ *  qu'aucun segment n'a ete modifie. Les petits tableaux (taille < TAILLE_MIN) sont laisses tels quels.
+ *  La variable d'environnement TRUST_DISABLE_NODE_SHARED_MEMORY desactive le mecanisme.
+ *
+ */
+class Memoire_Partagee_Noeud
+{
+public:
+  static void partager(TRUSTArray<double>& tab);
+  static void partager(TRUSTArray<int>& tab);
+  static void liberer();
+
+  static constexpr int TAILLE_MIN = 100000;
+
+private:
+  template <typename _TYPE_> static void partager_(TRUSTArray<_TYPE_>& tab);
+  static bool actif();
+};
+
+#endif /* Memoire_Partagee_Noeud_included */
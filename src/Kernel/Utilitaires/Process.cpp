@@ -26,6 +26,7 @@
 #include <comm_incl.h>
 #include <TRUST_Error.h>
 #include <Comm_Group_MPI.h>
+#include <Memoire_Partagee_Noeud.h>
 #include <unistd.h> // sleep() pour certaines machines
 #include <SChaine.h>
 #include <FichierHDFPar.h>
@@ -203,6 +204,32 @@ int Process::mp_sum(int x)
   return y;
 }
 
+/*! @brief Calcule la somme de x sur tous les processeurs du groupe courant en 64 bits.
+ *
+ * A utiliser pour les effectifs globaux (nombre total d'elements, de faces...) qui peuvent depasser 2^31.
+ *
+ */
+trustIdType Process::mp_sum_as_long(int x)
+{
+  const Comm_Group& grp = PE_Groups::current_group();
+  long x_long = x, y;
+  grp.mp_collective_op(&x_long, &y, 1, Comm_Group::COLL_SUM);
+  return y;
+}
+
+/*! @brief Somme partielle de x sur les processeurs de rang 0 a me()-1 du groupe courant, calculee sur 64 bits (0 sur le processeur 0).
+ *
+ * A utiliser pour les decalages de numerotation globale et les positions d'ecriture dans un fichier partage.
+ *
+ */
+trustIdType Process::mppartial_sum_as_long(trustIdType x)
+{
+  const Comm_Group& grp = PE_Groups::current_group();
+  long x_long = x, y;
+  grp.mp_collective_op(&x_long, &y, 1, Comm_Group::COLL_PARTIAL_SUM);
+  return y;
+}
+
 /*! @brief Calcule le 'et' logique de b sur tous les processeurs du groupe courant.
  *
  */
@@ -260,6 +287,8 @@ void Process::exit(const Nom& message ,int i)
   Journal() << message << finl;
   if( journal_shared_ && journal_file_open_)
     end_journal(verbose_level_);
+  else if (journal_file_open_)
+    journal_file_.attendre_ecritures(); // le journal doit etre complet avant un eventuel abort()
 
 
   if (exception_sur_exit)
@@ -312,6 +341,7 @@ void Process::exit(const Nom& message ,int i)
         }
       else
         {
+          Memoire_Partagee_Noeud::liberer();
 #ifdef MPI_
           MPI_Finalize();
 #endif
@@ -421,6 +451,9 @@ void init_journal_file(int verbose_level, int journal_shared, const char * file_
               IOS_OPEN_MODE mode = ios::out;
               if (append)
                 mode = ios::app;
+              // Chaque processeur ecrit son journal : avec TRUST_ASYNCHRONOUS_LOG, les ecritures sont deleguees
+              // a un thread pour ne pas bloquer le calcul sur le systeme de fichiers
+              journal_file_.set_asynchrone(true);
               if (!journal_file_.ouvrir(file_name, mode))
                 {
                   Cerr << "Fatal error in init_journal_file: cannot open journal file" << finl;
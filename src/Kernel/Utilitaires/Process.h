@@ -17,6 +17,7 @@
 #define Process_included
 
 #include <TRUST_Version.h>  // so that it is accessible from everywhere in TRUST
+#include <arch.h>
 
 #ifdef LATATOOLS
 #include <string>
@@ -60,6 +61,8 @@ public:
   static double mp_min(double) { return 0; }
   static int mp_min(int) { return 0; }
   static int mp_sum(int) { return 0; }
+  static trustIdType mp_sum_as_long(int) { return 0; }
+  static trustIdType mppartial_sum_as_long(trustIdType) { return 0; }
 
 #else
   static int me(); /* mon rang dans le groupe courant */
@@ -73,6 +76,8 @@ public:
   static double mp_min(double);
   static int mp_min(int);
   static int mp_sum(int);
+  static trustIdType mp_sum_as_long(int);
+  static trustIdType mppartial_sum_as_long(trustIdType);
 
   static int je_suis_maitre();
   static void exit(const Nom& message, int exit_code = -1);
@@ -0,0 +1,58 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#include <Reductions_Differees.h>
+#include <PE_Groups.h>
+
+/*! @brief Enregistre la valeur locale x a reduire avec l'operation op (COLL_SUM, COLL_MIN ou COLL_MAX).
+ *
+ * @return l'indice a passer a valeur() apres reduire()
+ */
+int Reductions_Differees::ajouter(double x, Comm_Group::Collective_Op op)
+{
+  if (op == Comm_Group::COLL_PARTIAL_SUM)
+    {
+      Cerr << "Reductions_Differees::ajouter: COLL_PARTIAL_SUM is not supported." << finl;
+      Process::exit();
+    }
+  if (reduit_)
+    vider();
+  valeurs_.push_back(x);
+  ops_.push_back(op);
+  return (int)valeurs_.size() - 1;
+}
+
+/*! @brief Reduit toutes les valeurs enregistrees en une seule operation collective sur le groupe courant.
+ *
+ */
+void Reductions_Differees::reduire()
+{
+  const int n = (int)valeurs_.size();
+  resultats_.resize(n);
+  if (n > 0)
+    PE_Groups::current_group().mp_collective_op(valeurs_.data(), resultats_.data(), ops_.data(), n);
+  reduit_ = true;
+}
+
+/*! @brief Oublie les valeurs enregistrees (appele automatiquement par ajouter() apres une reduction).
+ *
+ */
+void Reductions_Differees::vider()
+{
+  valeurs_.clear();
+  ops_.clear();
+  resultats_.clear();
+  reduit_ = false;
+}
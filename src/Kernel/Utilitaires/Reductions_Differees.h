@@ -0,0 +1,54 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#ifndef Reductions_Differees_included
+#define Reductions_Differees_included
+
+#include <Comm_Group.h>
+#include <vector>
+
+/*! @brief Regroupement de reductions scalaires paralleles independantes en une seule operation collective.
+ *
+ *  Les valeurs locales sont enregistrees avec ajouter() (somme, min ou max), puis reduire() effectue un unique
+ *  MPI_Allreduce sur le groupe courant a un point de synchronisation connu. Les resultats sont ensuite lus avec
+ *  valeur(). reduire() est collectif: tous les processeurs doivent enregistrer les memes operations dans le meme ordre.
+ *
+ *  Exemple:
+ *    Reductions_Differees red;
+ *    const int i_dt = red.ajouter(dt_local, Comm_Group::COLL_MIN), i_res = red.ajouter(residu_local, Comm_Group::COLL_MAX);
+ *    red.reduire();
+ *    dt = red.valeur(i_dt), residu = red.valeur(i_res);
+ */
+class Reductions_Differees
+{
+public:
+  int ajouter(double x, Comm_Group::Collective_Op op);
+  void reduire();
+  void vider();
+
+  inline double valeur(int i) const
+  {
+    assert(reduit_ && i >= 0 && i < (int)resultats_.size());
+    return resultats_[i];
+  }
+  inline int size() const { return (int)valeurs_.size(); }
+
+private:
+  std::vector<double> valeurs_, resultats_;
+  std::vector<Comm_Group::Collective_Op> ops_;
+  bool reduit_ = false;
+};
+
+#endif /* Reductions_Differees_included */
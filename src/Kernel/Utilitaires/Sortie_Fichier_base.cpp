@@ -14,6 +14,7 @@
 *****************************************************************************/
 
 #include <Sortie_Fichier_base.h>
+#include <Tampon_Ecriture_Asynchrone.h>
 #include <fstream>
 #include <Process.h>
 #include <Nom.h>
@@ -98,8 +99,30 @@ ofstream& Sortie_Fichier_base::get_ofstream()
   return *ofstream_;
 }
 
+/*! @brief Arrete le thread d'ecriture (apres ecriture des donnees en attente) et rebranche le flux sur son filebuf.
+ *
+ */
+void Sortie_Fichier_base::detacher_tampon_asynchrone()
+{
+  if (!tampon_asynchrone_)
+    return;
+  tampon_asynchrone_->arreter();
+  ofstream_->std::ios::rdbuf(ofstream_->rdbuf());
+  tampon_asynchrone_.reset();
+}
+
+/*! @brief Attend que les donnees deja ecrites soient transmises au fichier (bloquant, sans effet en mode synchrone).
+ *
+ */
+void Sortie_Fichier_base::attendre_ecritures()
+{
+  if (tampon_asynchrone_)
+    tampon_asynchrone_->attendre_ecritures();
+}
+
 void Sortie_Fichier_base::close()
 {
+  detacher_tampon_asynchrone();
   if(ofstream_)
     {
       ofstream_->flush();
@@ -152,6 +175,7 @@ int Sortie_Fichier_base::ouvrir(const char* name,IOS_OPEN_MODE mode)
   if (++counters[pathname]%100==0) Cerr << "Warning, file " << pathname << " has been opened/closed " << counters[pathname] << " times..." << finl;
   IOS_OPEN_MODE ios_mod=mode;
   int new_bin=0;
+  detacher_tampon_asynchrone(); // l'ancien flux va etre detruit
   if (bin_)
     {
 
@@ -174,6 +198,14 @@ int Sortie_Fichier_base::ouvrir(const char* name,IOS_OPEN_MODE mode)
       Process::exit();
     }
 
+  // Ecriture asynchrone (fichiers texte seulement) sur demande : variable d'environnement TRUST_ASYNCHRONOUS_LOG.
+  // Par defaut l'ecriture reste synchrone, afin que le journal contienne les derniers messages en cas d'arret brutal.
+  if (asynchrone_ && !bin_ && getenv("TRUST_ASYNCHRONOUS_LOG") != nullptr)
+    {
+      tampon_asynchrone_ = std::make_shared<Tampon_Ecriture_Asynchrone>(ofstream_->rdbuf());
+      ofstream_->std::ios::rdbuf(tampon_asynchrone_.get());
+    }
+
   if (new_bin)
     {
 #ifdef INT_is_64_
@@ -21,6 +21,8 @@
 #include <Nom.h>
 #include <memory>
 
+class Tampon_Ecriture_Asynchrone;
+
 using std::ifstream;
 using std::ofstream;
 using std::streampos;
@@ -41,6 +43,10 @@ public:
   virtual int ouvrir(const char* name,IOS_OPEN_MODE mode=ios::out);
 
   Sortie& flush() override;
+  // A appeler avant ouvrir() : si la variable d'environnement TRUST_ASYNCHRONOUS_LOG est definie, les ecritures sont
+  // alors faites par un thread dedie (fichiers de log, voir Tampon_Ecriture_Asynchrone)
+  void set_asynchrone(bool flag) { asynchrone_ = flag; }
+  void attendre_ecritures();
   static void set_root(const std::string dirname);
   static std::string root;
 
@@ -59,6 +65,9 @@ protected:
 private:
   char* internalBuff_ = nullptr;  // TODO - could be smart too
   int toFlush_;
+  bool asynchrone_ = false;
+  std::shared_ptr<Tampon_Ecriture_Asynchrone> tampon_asynchrone_;
+  void detacher_tampon_asynchrone();
   void set_buffer();
   void set_toFlush();
   int toFlush() { return toFlush_; }
@@ -374,6 +374,7 @@ Statistiques::Statistiques()
   total_time_ = 0;
   debug_level_ = 0;
   three_first_steps_elapsed_ = false;
+  main_thread_ = std::this_thread::get_id();
   stat_internals = new Stat_Internals();
 }
 
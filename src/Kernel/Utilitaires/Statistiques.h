@@ -18,6 +18,7 @@
 
 #include <assert.h>
 #include <string>
+#include <thread>
 class Stat_Counter_Id;
 class Stat_Results;
 class Stat_Internals;
@@ -188,6 +189,17 @@ public:
 
   int get_counter_id_from_description(const char* desc) const;
 
+  /*! @brief Return true if called from the thread which created the Statistiques object
+   *
+   * In hybrid MPI+threads mode, counters are only updated by this thread: a begin_count/end_count reached from a
+   * worker thread of the host thread team is silently ignored (the counters are not thread safe and the time spent
+   * in a threaded region is already accounted for by the enclosing counter).
+   */
+  inline bool is_main_thread() const
+  {
+    return std::this_thread::get_id() == main_thread_;
+  }
+
 protected:
   // Les deux fonctions suivantes peuvent etre appelees sur un seul processeur
   void begin_count_(const int id_);
@@ -196,6 +208,7 @@ protected:
   Stat_Internals * stat_internals;
   double total_time_;
   bool three_first_steps_elapsed_;  ///< If TRUE, the 3 first time steps are elapsed
+  std::thread::id main_thread_;     ///< Thread allowed to update the counters (see is_main_thread())
 
 };
 
@@ -266,7 +279,7 @@ public:
 inline void Statistiques::begin_count(const Stat_Counter_Id& counter_id, bool track_comm)
 {
   assert(counter_id.initialized());
-  if (counter_id.level_ <= debug_level_)
+  if (counter_id.level_ <= debug_level_ && is_main_thread())
     {
       begin_count_(counter_id.id_);
       if(track_comm) begin_communication_tracking(counter_id.id_);
@@ -290,7 +303,7 @@ inline void Statistiques::end_count(const Stat_Counter_Id& counter_id,
                                     bool track_comm)
 {
   assert(counter_id.initialized());
-  if (counter_id.level_ <= debug_level_)
+  if (counter_id.level_ <= debug_level_ && is_main_thread())
     {
       end_count_(counter_id.id_, quantity, count);
       if(track_comm) end_communication_tracking(counter_id.id_);
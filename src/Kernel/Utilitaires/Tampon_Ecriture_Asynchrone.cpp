@@ -0,0 +1,157 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+#include <Tampon_Ecriture_Asynchrone.h>
+
+Tampon_Ecriture_Asynchrone::Tampon_Ecriture_Asynchrone(std::streambuf *destination) : destination_(destination)
+{
+  setp(zone_.data(), zone_.data() + zone_.size());
+  ecrivain_ = std::thread(&Tampon_Ecriture_Asynchrone::boucle_ecriture, this);
+}
+
+Tampon_Ecriture_Asynchrone::~Tampon_Ecriture_Asynchrone()
+{
+  arreter();
+}
+
+/*! @brief Copie la zone d'ecriture directe dans le bloc courant (ou l'abandonne si le bloc est sature).
+ *
+ */
+void Tampon_Ecriture_Asynchrone::transferer_zone()
+{
+  const size_t n = (size_t) (pptr() - pbase());
+  if (n == 0)
+    return;
+  if (bloc_courant_.size() + n <= taille_max_bloc_)
+    bloc_courant_.append(pbase(), n);
+  else
+    octets_perdus_ += n;
+  setp(zone_.data(), zone_.data() + zone_.size());
+}
+
+/*! @brief Reveille les threads en attente sur cv. Le verrou pris puis relache avant la notification garantit qu'un thread
+ *
+ *   qui vient de tester son predicat (sous le verrou) est bien en attente : la notification ne peut pas etre perdue.
+ *
+ */
+void Tampon_Ecriture_Asynchrone::signaler(std::condition_variable& cv)
+{
+  {
+    std::lock_guard<std::mutex> verrou(mutex_);
+  }
+  cv.notify_all();
+}
+
+/*! @brief Depose le bloc courant dans la file si un emplacement est libre. Ne bloque jamais sur le systeme de fichiers.
+ *
+ */
+void Tampon_Ecriture_Asynchrone::deposer_bloc()
+{
+  if (bloc_courant_.empty())
+    return;
+  const size_t q = queue_.load(std::memory_order_relaxed);
+  if (q - tete_.load(std::memory_order_acquire) == nb_blocs_)
+    return; // file pleine : le bloc sera depose au prochain sync()
+  // L'emplacement a ete vide par le thread d'ecriture : l'echange recupere sa capacite pour le bloc courant
+  file_[q % nb_blocs_].swap(bloc_courant_);
+  bloc_courant_.clear();
+  queue_.store(q + 1, std::memory_order_release);
+  signaler(reveil_);
+}
+
+Tampon_Ecriture_Asynchrone::int_type Tampon_Ecriture_Asynchrone::overflow(int_type c)
+{
+  transferer_zone();
+  if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+  return traits_type::not_eof(c);
+}
+
+int Tampon_Ecriture_Asynchrone::sync()
+{
+  transferer_zone();
+  deposer_bloc();
+  return 0;
+}
+
+/*! @brief Boucle du thread d'ecriture : vide la file dans le tampon destination, puis dort jusqu'au prochain depot.
+ *
+ */
+void Tampon_Ecriture_Asynchrone::boucle_ecriture()
+{
+  while (true)
+    {
+      const size_t t = tete_.load(std::memory_order_relaxed);
+      if (t == queue_.load(std::memory_order_acquire))
+        {
+          // arret_ est positionne apres le dernier depot : on relit la queue avant de sortir
+          if (arret_.load(std::memory_order_acquire) && t == queue_.load(std::memory_order_acquire))
+            break;
+          std::unique_lock<std::mutex> verrou(mutex_);
+          reveil_.wait(verrou, [&] { return t != queue_.load(std::memory_order_acquire) || arret_.load(std::memory_order_acquire); });
+          continue;
+        }
+      std::string& bloc = file_[t % nb_blocs_];
+      destination_->sputn(bloc.data(), (std::streamsize) bloc.size());
+      bloc.clear();
+      tete_.store(t + 1, std::memory_order_release);
+      if (t + 1 == queue_.load(std::memory_order_acquire))
+        {
+          destination_->pubsync();
+          signaler(file_vide_);
+        }
+    }
+  destination_->pubsync();
+}
+
+/*! @brief Attend que tout ce qui a ete ecrit soit transmis au tampon destination.
+ *
+ * Bloquant : a reserver aux fins de calcul (fermeture du fichier, sortie sur erreur).
+ *
+ */
+void Tampon_Ecriture_Asynchrone::attendre_ecritures()
+{
+  transferer_zone();
+  deposer_bloc();
+  while (!bloc_courant_.empty() || tete_.load(std::memory_order_acquire) != queue_.load(std::memory_order_relaxed))
+    {
+      {
+        std::unique_lock<std::mutex> verrou(mutex_);
+        file_vide_.wait(verrou, [&] { return tete_.load(std::memory_order_acquire) == queue_.load(std::memory_order_relaxed); });
+      }
+      deposer_bloc(); // la file etait pleine : le reste du bloc courant peut maintenant etre depose
+    }
+}
+
+/*! @brief Ecrit les donnees en attente puis arrete le thread d'ecriture.
+ *
+ */
+void Tampon_Ecriture_Asynchrone::arreter()
+{
+  if (!ecrivain_.joinable())
+    return;
+  if (octets_perdus_ > 0)
+    {
+      attendre_ecritures();
+      bloc_courant_ = "\n[" + std::to_string(octets_perdus_) + " bytes of messages lost: asynchronous output was saturated]\n";
+      octets_perdus_ = 0;
+    }
+  attendre_ecritures();
+  arret_.store(true, std::memory_order_release);
+  signaler(reveil_);
+  ecrivain_.join();
+}
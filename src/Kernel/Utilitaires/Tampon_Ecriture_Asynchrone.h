@@ -0,0 +1,76 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+#ifndef Tampon_Ecriture_Asynchrone_included
+#define Tampon_Ecriture_Asynchrone_included
+
+#include <condition_variable>
+#include <streambuf>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <array>
+
+/*! @brief Tampon d'ecriture (std::streambuf) dont le contenu est ecrit dans un tampon destination par un thread dedie.
+ *
+ *  Le thread de calcul accumule les caracteres dans un bloc local. A chaque sync() (flush, finl...), le bloc est
+ *  depose dans une file circulaire sans verrou (un seul producteur, un seul consommateur) que le thread d'ecriture
+ *  vide dans le tampon destination (typiquement le filebuf d'un fichier). Le thread d'ecriture dort sur une variable
+ *  condition tant que la file est vide : il est reveille a chaque depot de bloc et a l'arret.
+ *  Le thread de calcul n'attend jamais le systeme de fichiers : si la file est pleine, le bloc local continue
+ *  de grossir et, au dela de taille_max_bloc_, les messages sont abandonnes (le nombre d'octets perdus est
+ *  ecrit a l'arret du tampon).
+ *
+ * @sa Sortie_Fichier_base::set_asynchrone()
+ */
+class Tampon_Ecriture_Asynchrone : public std::streambuf
+{
+public:
+  explicit Tampon_Ecriture_Asynchrone(std::streambuf *destination);
+  ~Tampon_Ecriture_Asynchrone() override;
+  Tampon_Ecriture_Asynchrone(const Tampon_Ecriture_Asynchrone&) = delete;
+  Tampon_Ecriture_Asynchrone& operator=(const Tampon_Ecriture_Asynchrone&) = delete;
+
+  void attendre_ecritures();
+  void arreter();
+
+protected:
+  int_type overflow(int_type c) override;
+  int sync() override;
+
+private:
+  void transferer_zone();
+  void deposer_bloc();
+  void boucle_ecriture();
+  void signaler(std::condition_variable& cv);
+
+  static constexpr size_t nb_blocs_ = 64;
+  static constexpr size_t taille_max_bloc_ = 16 << 20;
+
+  std::streambuf *destination_;
+  std::array<char, 4096> zone_;                 // zone d'ecriture directe du streambuf
+  std::string bloc_courant_;                    // bloc en cours de remplissage (thread de calcul)
+  std::array<std::string, nb_blocs_> file_;     // file circulaire des blocs a ecrire
+  std::atomic<size_t> tete_ {0};                // prochain bloc a ecrire (modifie par le thread d'ecriture)
+  std::atomic<size_t> queue_ {0};               // prochain emplacement libre (modifie par le thread de calcul)
+  std::atomic<bool> arret_ {false};
+  std::mutex mutex_;                            // protege seulement l'attente sur reveil_ et file_vide_
+  std::condition_variable reveil_;              // bloc depose ou arret demande (attendu par le thread d'ecriture)
+  std::condition_variable file_vide_;           // file videe (attendu par attendre_ecritures())
+  size_t octets_perdus_ = 0;
+  std::thread ecrivain_;
+};
+
+#endif /* Tampon_Ecriture_Asynchrone_included */
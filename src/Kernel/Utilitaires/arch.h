@@ -74,6 +74,11 @@ typedef int entier;
 typedef int integer;
 typedef int True_int;
 //#define INT_is_64_
+
+// Les indices locaux (connectivites, tableaux distribues, matrices Morse) restent des int (4 octets) sur chaque processeur.
+// Les numerotations et effectifs globaux (sommes sur tous les processeurs, decalages d'ecriture) utilisent trustIdType
+// (8 octets) afin de depasser 2^31 items sans doubler la memoire des connectivites locales.
+typedef long trustIdType;
 extern char* pwd();
 
 #endif // _ARCH_H_
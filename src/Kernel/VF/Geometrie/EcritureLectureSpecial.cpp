@@ -22,6 +22,7 @@
 #include <Octree_Double.h>
 #include <MD_Vector_composite.h>
 #include <TRUSTTab_parts.h>
+#include <climits>
 
 int EcritureLectureSpecial::mode_ecr=-1;
 int EcritureLectureSpecial::mode_lec=0;
@@ -252,14 +253,21 @@ int EcritureLectureSpecial::ecriture_special(const Domaine_VF& zvf, Sortie& fich
       Cerr << "EcritureLectureSpecial::ecriture_special: error, cannot save an array with no metadata" << finl;
       Process::exit();
     }
-  const int nb_items_seq = md.valeur().nb_items_seq_tot();
+  const trustIdType nb_items_seq = md.valeur().nb_items_seq_tot();
   if (nb_items_seq == 0)
     return 0;
 
   const int nb_dim = val.nb_dim();
   const int nb_comp = (nb_dim == 2) ? val.dimension(1) : 1;
   const int dim = Objet_U::dimension;
-  const int n = nb_items_seq * (nb_comp + dim);
+  // L'entete du format xyz stocke le nombre de valeurs sur un int
+  const trustIdType n_tot = nb_items_seq * (nb_comp + dim);
+  if (n_tot > INT_MAX)
+    {
+      Cerr << "EcritureLectureSpecial::ecriture_special: " << n_tot << " values exceed the capacity of the xyz format (" << INT_MAX << ")." << finl;
+      Process::exit();
+    }
+  const int n = (int)n_tot;
 
 
   if (Process::je_suis_maitre())
@@ -514,7 +522,7 @@ void EcritureLectureSpecial::lecture_special(const Domaine_VF& zvf, Entree& fich
       Cerr << "EcritureLectureSpecial::ecriture_special: error, cannot save an array with no metadata" << finl;
       Process::exit();
     }
-  const int nb_items_seq = md_vect.valeur().nb_items_seq_tot();
+  const trustIdType nb_items_seq = md_vect.valeur().nb_items_seq_tot();
   if (nb_items_seq == 0)
     return;
 
@@ -46,6 +46,7 @@ void usage()
   Cerr << " -check_enabled=0|1  => enables or disables runtime checking of parallel messages\n";
   Cerr << " -debugscript=SCRIPT => execute \"SCRIPT n\" after parallel initialisation, n=processor rank\n";
   Cerr << " -petsc=0            => disable call to PetscInitialize\n";
+  Cerr << " -threads=N          => number of host threads used by each MPI process for the Kokkos kernels (hybrid MPI+threads mode)\n";
   Cerr << " -journal=0..9       => select journal level (0=disable, 9=maximum verbosity)\n";
   Cerr << " -journal_master     => only master processor writes a journal (not compatible with journal_shared)\n";
   Cerr << " -journal_shared     => each processor writes in a single log file (not compatible with journal_master)\n";
@@ -82,6 +83,7 @@ int main_TRUST(int argc, char** argv,mon_main*& main_process,int force_mpi)
   int with_mpi = force_mpi;
   int check_enabled = DEFAULT_CHECK_ENABLED;
   int with_petsc = -1;       // -1 => use petsc if compiled
+  int nb_threads = 0;        // 0 => choix laisse a Kokkos (OMP_NUM_THREADS, --kokkos-num-threads, ...)
   int nproc = -1;
   int verbose_level = -1;
   int journal_master = 0;
@@ -148,6 +150,19 @@ int main_TRUST(int argc, char** argv,mon_main*& main_process,int force_mpi)
           with_petsc = 0;
           arguments_info += "-petsc=0 => disable call to PetscInitialize\n";
         }
+      else if (strncmp(argv[i], "-threads=", 9) == 0)
+        {
+          int n = atoi(argv[i]+9);
+          if (n < 1)
+            Cerr << "Bad number of threads : " << argv[i] << finl;
+          else
+            {
+              nb_threads = n;
+              arguments_info += "-threads=";
+              arguments_info += Nom(n);
+              arguments_info += " => hybrid MPI+threads mode\n";
+            }
+        }
       else if (strncmp(argv[i], "-journal=", 9) == 0)
         {
           int level = atoi(argv[i]+9);
@@ -299,7 +314,7 @@ int main_TRUST(int argc, char** argv,mon_main*& main_process,int force_mpi)
     //  mis dans mon_main)
     main_process=new  mon_main(verbose_level, journal_master, journal_shared, log_directory, apply_verification, disable_stop);
 
-    main_process->init_parallel(argc, argv, with_mpi, check_enabled, with_petsc);
+    main_process->init_parallel(argc, argv, with_mpi, check_enabled, with_petsc, nb_threads);
 
     // *************************  <PARALLEL_OK> *****************************
     // A partir d'ici on a le droit d'utiliser les communications entre processeurs,
@@ -19,6 +19,7 @@
 #include <instancie_appel.h>
 #include <SFichier.h>
 #include <Comm_Group_MPI.h>
+#include <Memoire_Partagee_Noeud.h>
 #include <PE_Groups.h>
 #include <Journal.h>
 #include <cstdio>
@@ -66,6 +67,10 @@ static int init_petsc(True_int argc, char **argv, int with_mpi,int& trio_began_m
 #ifdef PETSCKSP_H
   static char help[] = "TRUST may solve linear systems with Petsc library.\n\n" ;
   Nom pwd(::pwd());
+#ifdef MPI_
+  // Si PetscInitialize initialise MPI, niveau requis pour le mode hybride MPI+threads (seul le thread principal communique):
+  PETSC_MPI_THREAD_REQUIRED = MPI_THREAD_FUNNELED;
+#endif
   // On initialise Petsc
 #ifdef MPI_INIT_NEEDS_MPIRUN
   True_int flag;
@@ -115,7 +120,9 @@ static int init_petsc(True_int argc, char **argv, int with_mpi,int& trio_began_m
   MPI_Initialized(&flag);
   if (!flag)
     {
-      MPI_Init(&argc,&argv);
+      // MPI_THREAD_FUNNELED: seul le thread principal communique (mode hybride MPI+threads)
+      True_int niveau_fourni;
+      MPI_Init_thread(&argc,&argv,MPI_THREAD_FUNNELED,&niveau_fourni);
       trio_began_mpi_=1;
     }
 #endif
@@ -141,14 +148,26 @@ static int init_parallel_mpi(DERIV(Comm_Group) & groupe_trio)
 // sont dans un seul fichier: mon_main
 // On ne doit pas en voir ailleurs !
 //////////////////////////////////////////////////////////
-void mon_main::init_parallel(const int argc, char **argv, int with_mpi, int check_enabled, int with_petsc)
+void mon_main::init_parallel(const int argc, char **argv, int with_mpi, int check_enabled, int with_petsc, int nb_threads)
 {
+  // Mode hybride MPI+threads: chaque processus MPI execute ses kernels Kokkos (backend hote) avec nb_threads threads.
+  // On passe par la variable d'environnement lue par Kokkos::initialize, ainsi une option --kokkos-num-threads
+  // explicite sur la ligne de commande reste prioritaire:
+  if (nb_threads > 0)
+    setenv("KOKKOS_NUM_THREADS", std::to_string(nb_threads).c_str(), 1);
+
   // Kokkos initialisation
   True_int argc2 = argc;
   Kokkos::initialize( argc2, argv );
 
   Nom arguments_info="";
-  arguments_info +="Kokkos initialized!\n";
+  arguments_info +="Kokkos initialized with ";
+  arguments_info += Nom((int)Kokkos::DefaultHostExecutionSpace().concurrency());
+  arguments_info +=" host thread(s) per process (host backend ";
+  arguments_info += Kokkos::DefaultHostExecutionSpace::name();
+  arguments_info +=")!\n";
+  if (nb_threads > 1 && Kokkos::DefaultHostExecutionSpace().concurrency() == 1)
+    arguments_info += "Warning: -threads option ignored, Kokkos has been built without a multi-threaded host backend.\n";
 
 #ifdef TRUST_USE_CUDA
   //init_cuda(); Desactive car crash crash sur topaze ToDo OpenMP
@@ -196,6 +215,15 @@ void mon_main::init_parallel(const int argc, char **argv, int with_mpi, int chec
       groupe_trio_.typer("Comm_Group_NoParallel");
     }
 
+#ifdef MPI_
+  if (with_mpi && nb_threads > 1)
+    {
+      True_int niveau_fourni;
+      MPI_Query_thread(&niveau_fourni);
+      if (niveau_fourni < MPI_THREAD_FUNNELED)
+        arguments_info += "Warning: the MPI library does not provide MPI_THREAD_FUNNELED, the hybrid MPI+threads mode may be unsafe.\n";
+    }
+#endif
   // Initialisation des groupes de communication.
   PE_Groups::initialize(groupe_trio_);
   arguments_info += "Parallel engine initialized : ";
@@ -215,6 +243,8 @@ void mon_main::finalize()
   // to make sure all Kokkos views are freed before doing Kokkos finalize):
   TClearable::Clear_all();
 
+  // Fenetres partagees par noeud liberees avant le communicateur du noeud
+  Memoire_Partagee_Noeud::liberer();
 #ifdef MPI_
   // MPI_Group_free before MPI_Finalize
   if (sub_type(Comm_Group_MPI,groupe_trio_.valeur()))
@@ -384,7 +414,9 @@ void mon_main::dowork(const Nom& nom_du_cas)
       }
     Cerr << "MAIN: Reading and executing data file" << finl;
     {
+      const double t_lecture = Statistiques::get_time_now();
       LecFicDiffuse_JDD lit_entree(nomentree, ios::in, apply_verification_);
+      Cout << "clock: Data file reading and broadcast: " << Statistiques::get_time_now() - t_lecture << " s" << finl;
       lit_entree.set_check_types(1);
       interprete_principal_.interpreter_bloc(lit_entree,
                                              Interprete_bloc::FIN /* on attend FIN a la fin */,
@@ -41,7 +41,7 @@ public:
   mon_main(int verbose_level = 9, int journal_master = 0, int journal_shared = 0, Nom log_directory = "",  bool apply_verification=true, int disable_stop = 0);
   ~mon_main();
   void init_parallel(const int argc, char **argv,
-                     int with_mpi, int check_enabled = 0, int with_petsc = 1);
+                     int with_mpi, int check_enabled = 0, int with_petsc = 1, int nb_threads = 0);
   void finalize();
   void dowork(const Nom& nom_du_cas);
 
@@ -136,36 +136,25 @@ void Frottement_interfacial_PolyMAC_P0::ajouter_blocs(matrices_t matrices, Doubl
               }
       }
 
-  /* elements */
-  for (e = 0; e < domaine.nb_elem_tot(); e++)
-    {
-      /* arguments de coeff */
-      for (n = 0; n < N; n++)
-        {
-          a_l(n)   = alpha(e, n);
-          p_l(n)   = press(e, n * (Np > 1));
-          T_l(n)   =  temp(e, n);
-          rho_l(n) =   rho(!cR * e, n);
-          mu_l(n)  =    mu(!cM * e, n);
-          for (k = n+1; k < N; k++)
-            {
-              const int ind_trav = (n*(N-1)-(n-1)*(n)/2) + (k-n-1);
-              sigma_l(ind_trav) = Sigma_tab(e, ind_trav);
-            }
-          d_bulles_l(n) = (d_bulles) ? (*d_bulles)(e,n) : 0;
-
-          for (k = 0; k < N; k++) dv(k, n) = std::max(ch.v_norm(pvit, pvit, e, -1, k, n, nullptr, &ddv(k, n, 0)), dv_min);
-
-        }
-
-      correlation_fi.coefficient(a_l, p_l, T_l, rho_l, mu_l, sigma_l, dh_e(e), dv, d_bulles_l, coeff);
+  /* elements : arguments de coeff ranges par element, puis un seul appel a la correlation pour tous les elements */
+  DoubleTrav p_e(ne_tot, N), dv_e(ne_tot, N, N), ddv_e(ne_tot, N, N, 4), d_bulles_e(ne_tot, N), coeff_e(ne_tot, N, N, 2);
+  for (e = 0; e < ne_tot; e++)
+    for (n = 0; n < N; n++)
+      {
+        p_e(e, n) = press(e, n * (Np > 1));
+        d_bulles_e(e, n) = (d_bulles) ? (*d_bulles)(e,n) : 0;
+        for (k = 0; k < N; k++) dv_e(e, k, n) = std::max(ch.v_norm(pvit, pvit, e, -1, k, n, nullptr, &ddv_e(e, k, n, 0)), dv_min);
+      }
+  correlation_fi.coefficient_lot(alpha, p_e, temp, rho, mu, Sigma_tab, dh_e, dv_e, d_bulles_e, coeff_e);
 
+  for (e = 0; e < ne_tot; e++)
+    {
       for (k = 0; k < N; k++)
         for (l = 0; l < N; l++)
           {
-            coeff(k, l, 1) *= (dv(k, l) > dv_min); //pas de derivee si dv < dv_min
+            coeff_e(e, k, l, 1) *= (dv_e(e, k, l) > dv_min); //pas de derivee si dv < dv_min
             for (j = 0; j < 2; j++)
-              coeff(k, l, j) *= 1 + (a_l(k) > 1e-8 ? std::pow(a_l(k) / a_res_, -exp_res) : 0) + (a_l(l) > 1e-8 ? std::pow(a_l(l) / a_res_, -exp_res) : 0);
+              coeff_e(e, k, l, j) *= 1 + (alpha(e, k) > 1e-8 ? std::pow(alpha(e, k) / a_res_, -exp_res) : 0) + (alpha(e, l) > 1e-8 ? std::pow(alpha(e, l) / a_res_, -exp_res) : 0);
           }
 
       for (d = 0, i = nf_tot + D * e; d < D; d++, i++)
@@ -175,9 +164,9 @@ void Frottement_interfacial_PolyMAC_P0::ajouter_blocs(matrices_t matrices, Doubl
               {
                 double fac = beta_ * pe(e) * ve(e);
                 /* on essaie d'impliciter coeff sans ralentir la convergence en en faisant un developpement limite autour de pvit (dans la direction d'interet seulement) */
-                secmem(i, k) -= fac * (coeff(k, l, 0) * (inco(i, k) - inco(i, l)) + coeff(k, l, 1) * ddv(k, l, d) * (pvit(i, k) - pvit(i, l)) * ((inco(i, k) - inco(i, l)) - (pvit(i, k) - pvit(i, l))));
+                secmem(i, k) -= fac * (coeff_e(e, k, l, 0) * (inco(i, k) - inco(i, l)) + coeff_e(e, k, l, 1) * ddv_e(e, k, l, d) * (pvit(i, k) - pvit(i, l)) * ((inco(i, k) - inco(i, l)) - (pvit(i, k) - pvit(i, l))));
                 if (mat)
-                  for (j = 0; j < 2; j++) (*mat)(N * i + k, N * i + (j ? l : k)) += fac * (j ? -1 : 1) * (coeff(k, l, 0) + coeff(k, l, 1) * ddv(k, l, d) * (pvit(i, k) - pvit(i, l)));
+                  for (j = 0; j < 2; j++) (*mat)(N * i + k, N * i + (j ? l : k)) += fac * (j ? -1 : 1) * (coeff_e(e, k, l, 0) + coeff_e(e, k, l, 1) * ddv_e(e, k, l, d) * (pvit(i, k) - pvit(i, l)));
               }
     }
 }
@@ -28,6 +28,7 @@
 #include <TRUSTLists.h>
 #include <Dirichlet.h>
 #include <Param.h>
+#include <Device.h>
 #include <cmath>
 
 extern Stat_Counter_Id convection_counter_;
@@ -56,31 +57,45 @@ Entree& Op_Conv_Centre_PolyMAC_P0_Face::readOn(Entree& is)
 
 double Op_Conv_EF_Stab_PolyMAC_P0_Face::calculer_dt_stab() const
 {
-  double dt = 1e10;
   const Domaine_Poly_base& domaine = le_dom_poly_.valeur();
   const Champ_Face_PolyMAC_P0& ch = ref_cast(Champ_Face_PolyMAC_P0, equation().inconnue().valeur());
-  const DoubleVect& fs = domaine.face_surfaces(), &pf = equation().milieu().porosite_face(), &ve = domaine.volumes(), &pe = equation().milieu().porosite_elem(), &vf = domaine.volumes_entrelaces();
-  const DoubleTab& vit = vitesse_->valeurs(), &vfd = domaine.volumes_entrelaces_dir(), *alp =
-                                                       sub_type(Pb_Multiphase, equation().probleme()) ? &ref_cast(Pb_Multiphase, equation().probleme()).equation_masse().inconnue().passe() : nullptr;
+  const DoubleVect& fs = domaine.face_surfaces(), &pf = equation().milieu().porosite_face(), &ve = domaine.volumes(), &pe = equation().milieu().porosite_elem();
+  const DoubleTab& vit = vitesse_->valeurs(), *alp = sub_type(Pb_Multiphase, equation().probleme()) ? &ref_cast(Pb_Multiphase, equation().probleme()).equation_masse().inconnue().passe() : nullptr;
   const IntTab& e_f = domaine.elem_faces(), &f_e = domaine.face_voisins(), &fcl = ch.fcl();
-  int i, e, f, n, N = vit.line_size();
-  DoubleTrav flux(N), vol(N); //somme des flux pf * |f| * vf, volume minimal des mailles d'elements/faces affectes par ce flux
+  const int N = vit.line_size(), nb_faces_elem = e_f.dimension(1), traitement_axi = Option_PolyMAC_P0::traitement_axi, has_alp = alp != nullptr;
 
-  for (e = 0; e < domaine.nb_elem(); e++)
-    {
-      for (vol = pe(e) * ve(e), flux = 0, i = 0; i < e_f.dimension(1) && (f = e_f(e, i)) >= 0; i++)
-        if (!Option_PolyMAC_P0::traitement_axi || (Option_PolyMAC_P0::traitement_axi && fcl(f,0) != 2) )
-          for (n = 0; n < N; n++)
-            {
-              flux(n) += pf(f) * fs(f) * std::max((e == f_e(f, 1) ? 1 : -1) * vit(f, n), 0.); //seul le flux entrant dans e compte
-              if (0 && fcl(f, 0) < 2) vol(n) = std::min(vol(n), pf(f) * vf(f) / vfd(f, e != f_e(f, 0)) * vf(f)); //prise en compte de la contribution aux faces
-            }
-      for (n = 0; n < N; n++)
-        if ((!alp || (*alp)(e, n) > 1e-3) && std::abs(flux(n)) > 1e-12 /* eviter les valeurs 'tres proches de 0 mais pas completement nulles' */)
-          dt = std::min(dt, vol(n) / flux(n));
-    }
+  DoubleTrav dt_e(domaine.nb_elem()); //pas de temps de stabilite de chaque element
+  dt_e = 1e10;
+
+  CIntTabView e_f_v = e_f.view_ro(), f_e_v = f_e.view_ro(), fcl_v = fcl.view_ro();
+  CDoubleArrView fs_v = fs.view_ro(), pf_v = pf.view_ro(), ve_v = ve.view_ro(), pe_v = pe.view_ro();
+  CDoubleTabView vit_v = vit.view_ro(), alp_v = (has_alp ? *alp : vit).view_ro();
+  DoubleTabView dt_e_v = dt_e.view_rw();
+
+  auto kern_dt_stab = KOKKOS_LAMBDA(int e)
+  {
+    for (int n = 0; n < N; n++)
+      {
+        double flux = 0, vol = pe_v(e) * ve_v(e); //somme des flux pf * |f| * vf, volume de l'element
+        for (int i = 0; i < nb_faces_elem; i++)
+          {
+            const int f = e_f_v(e, i);
+            if (f < 0) break;
+            if (!traitement_axi || fcl_v(f, 0) != 2)
+              {
+                const double v = (e == f_e_v(f, 1) ? 1 : -1) * vit_v(f, n);
+                flux += pf_v(f) * fs_v(f) * (v > 0 ? v : 0.); //seul le flux entrant dans e compte
+              }
+          }
+        if ((!has_alp || alp_v(e, n) > 1e-3) && Kokkos::fabs(flux) > 1e-12 /* eviter les valeurs 'tres proches de 0 mais pas completement nulles' */ && vol / flux < dt_e_v(e, 0))
+          dt_e_v(e, 0) = vol / flux;
+      }
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Elem loop in Op_Conv_EF_Stab_PolyMAC_P0_Face::calculer_dt_stab", domaine.nb_elem(), kern_dt_stab);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Elem loop in Op_Conv_EF_Stab_PolyMAC_P0_Face::calculer_dt_stab");
 
-  return Process::mp_min(dt);
+  return Process::mp_min(std::min(1e10, dt_e.local_min_vect()));
 }
 
 void Op_Conv_EF_Stab_PolyMAC_P0_Face::dimensionner_blocs(matrices_t matrices, const tabs_t& semi_impl) const
@@ -134,6 +149,18 @@ void Op_Conv_EF_Stab_PolyMAC_P0_Face::dimensionner_blocs(matrices_t matrices, co
   mat.nb_colonnes() ? mat += mat2 : mat = mat2;
 }
 
+// Ajoute v a la case (i, j) d'une matrice Morse (tab1/tab2 numerotes a partir de 1) ; compte les cases hors stencil
+KOKKOS_INLINE_FUNCTION void ajouter_coeff_morse(const CIntArrView& tab1, const CIntArrView& tab2, const DoubleArrView& coeff, const IntArrView& nb_hors_stencil, int i, int j, double v)
+{
+  for (int k = tab1(i) - 1; k < tab1(i + 1) - 1; k++)
+    if (tab2(k) == j + 1)
+      {
+        Kokkos::atomic_add(&coeff(k), v);
+        return;
+      }
+  Kokkos::atomic_add(&nb_hors_stencil(0), 1);
+}
+
 // ajoute la contribution de la convection au second membre resu
 // renvoie resu
 void Op_Conv_EF_Stab_PolyMAC_P0_Face::ajouter_blocs(matrices_t matrices, DoubleTab& secmem, const tabs_t& semi_impl) const
@@ -155,14 +182,17 @@ void Op_Conv_EF_Stab_PolyMAC_P0_Face::ajouter_blocs(matrices_t matrices, DoubleT
                     *alp = pbm ? &pbm->equation_masse().inconnue().passe() : nullptr, &rho = equation().milieu().masse_volumique().passe();
   Matrice_Morse *mat = matrices.count(nom_inco) && !semi_impl.count(nom_inco) ? matrices.at(nom_inco) : nullptr;
 
-  int i, j, k, e, eb, f, fb, fc, fd, nf_tot = domaine.nb_faces_tot(), m, n, N = inco.line_size(), d, D = dimension, comp = !incompressible_;
-  double mult;
+  int i, e, eb, f, n, m, d, nf_tot = domaine.nb_faces_tot(), N = inco.line_size(), D = dimension, comp = !incompressible_;
+  const int nb_faces = domaine.nb_faces(), nb_faces_elem = e_f.dimension(1), has_mat = mat != nullptr;
 
-  DoubleTrav dfac(2, N, N), masse(N, N);
-  for (f = 0; f < domaine.nb_faces_tot(); f++)
+  /* Preparation sur l'hote (masse ajoutee et valeurs de Dirichlet passent par des appels virtuels) :
+   * dfac(f, (j * N + n) * N + m) : flux de masse de la face f porte par son voisin j
+   * val_dir(f, N * d + m) : vitesse imposee sur une face de Dirichlet */
+  DoubleTrav dfac(nf_tot, 2 * N * N), masse(N, N), val_dir(nf_tot, D * N);
+  for (f = 0; f < nf_tot; f++)
     if (f_e(f, 0) >= 0 && (f_e(f, 1) >= 0 || fcl(f, 0) == 1 || fcl(f, 0) == 3))
       {
-        for (i = 0, dfac = 0; i < 2; i++)
+        for (i = 0; i < 2; i++)
           {
             //masse : diagonale + masse ajoutee si correlation
             for (masse = 0, e = f_e(f, f_e(f, i) >= 0 ? i : 0), n = 0; n < N; n++)
@@ -170,78 +200,130 @@ void Op_Conv_EF_Stab_PolyMAC_P0_Face::ajouter_blocs(matrices_t matrices, DoubleT
             if (corr)
               corr->ajouter(&(*alp)(e, 0), &rho(e, 0), masse);
             //contribution a dfac
-            for (e = f_e(f, i), eb = f_e(f, i), n = 0; n < N; n++)
+            for (eb = f_e(f, i), n = 0; n < N; n++)
               for (m = 0; m < N; m++)
-                dfac(fcl(f, 0) == 1 ? 0 : i, n, m) += fs(f) * vit(f, m) * pe(eb >= 0 ? eb : f_e(f, 0)) * masse(n, m) * (1. + (vit(f, m) * (i ? -1 : 1) >= 0 ? 1. : vit(f, m) ? -1. : 0.) * alpha) / 2;
+                dfac(f, ((fcl(f, 0) == 1 ? 0 : i) * N + n) * N + m) += fs(f) * vit(f, m) * pe(eb >= 0 ? eb : f_e(f, 0)) * masse(n, m) * (1. + (vit(f, m) * (i ? -1 : 1) >= 0 ? 1. : vit(f, m) ? -1. : 0.) * alpha) / 2;
           }
-        for (i = 0; i < 2 && (e = f_e(f, i)) >= 0; i++)
+        if (fcl(f, 0) == 3)
+          for (d = 0; d < D; d++)
+            for (m = 0; m < N; m++)
+              val_dir(f, N * d + m) = ref_cast(Dirichlet, cls[fcl(f, 1)].valeur()).val_imp(fcl(f, 2), N * d + m);
+      }
+
+  CIntTabView f_e_v = f_e.view_ro(), e_f_v = e_f.view_ro(), fcl_v = fcl.view_ro();
+  ConstViewTab3<int> equiv_v = equiv.view3_ro();
+  CDoubleTabView nf_v = nf.view_ro(), vfd_v = vfd.view_ro(), inco_v = inco.view_ro(), dfac_v = dfac.view_ro(), val_dir_v = val_dir.view_ro();
+  CDoubleArrView fs_v = fs.view_ro(), pe_v = pe.view_ro(), pf_v = pf.view_ro(), ve_v = ve.view_ro();
+  DoubleTabView secmem_v = secmem.view_rw();
+
+  /* matrice : la case de chaque contribution est cherchee dans sa ligne (stencil de dimensionner_blocs) */
+  IntVect tab_vide(2);
+  DoubleVect coeff_vide(1);
+  IntTrav nb_hors_stencil(1);
+  CIntArrView tab1_v = (has_mat ? mat->get_tab1() : tab_vide).view_ro(), tab2_v = (has_mat ? mat->get_tab2() : tab_vide).view_ro();
+  DoubleArrView coeff_v = (has_mat ? mat->get_set_coeff() : coeff_vide).view_rw();
+  IntArrView nb_hors_stencil_v = nb_hors_stencil.view_rw();
+
+  // Boucle sur les faces : les lignes des faces et des elements voisins sont partagees -> atomic_add
+  auto kern_ajouter_blocs = KOKKOS_LAMBDA(int f_)
+  {
+    if (f_e_v(f_, 0) < 0 || (f_e_v(f_, 1) < 0 && fcl_v(f_, 0) != 1 && fcl_v(f_, 0) != 3))
+      return;
+    for (int i_ = 0; i_ < 2; i_++)
+      {
+        const int e_ = f_e_v(f_, i_);
+        if (e_ < 0) break;
+        const double sgn = i_ ? -1 : 1;
+        for (int k = 0; k < nb_faces_elem; k++)
           {
-            for (k = 0; k < e_f.dimension(1) && (fb = e_f(e, k)) >= 0; k++)
-              if (fb < domaine.nb_faces() && fcl(fb, 0) < 2) //partie "faces"
+            const int fb = e_f_v(e_, k);
+            if (fb < 0) break;
+            if (fb >= nb_faces || fcl_v(fb, 0) >= 2) continue; //partie "faces"
+            const int fc = equiv_v(f_, i_, k);
+            const double vfd_fb = vfd_v(fb, e_ != f_e_v(fb, 0));
+            if (fc >= 0 || f_e_v(f_, 1) < 0)
+              for (int j = 0; j < 2; j++) //equivalence : face fd -> face fb
                 {
-                  if ((fc = equiv(f, i, k)) >= 0 || f_e(f, 1) < 0)
-                    for (j = 0; j < 2; j++) //equivalence : face fd -> face fb
+                  const int eb_ = f_e_v(f_, j), fd = (j == i_ ? fb : fc); //element/face sources
+                  double prod = 0;
+                  if (fd >= 0)
+                    for (int d_ = 0; d_ < D; d_++)
+                      prod += nf_v(fb, d_) * nf_v(fd, d_);
+                  const double mult = (fd < 0 || prod > 0 ? 1 : -1) * (fd >= 0 ? pf_v(fd) / pe_v(eb_) : 1); //multiplicateur pour passer de vf a ve
+                  for (int n_ = 0; n_ < N; n_++)
+                    for (int m_ = 0; m_ < N; m_++)
                       {
-                        eb = f_e(f, j), fd = (j == i ? fb : fc); //element/face sources
-                        mult = (fd < 0 || domaine.dot(&nf(fb, 0), &nf(fd, 0)) > 0 ? 1 : -1) * (fd >= 0 ? pf(fd) / pe(eb) : 1); //multiplicateur pour passer de vf a ve
-                        for (n = 0; n < N; n++)
-                          for (m = 0; m < N; m++)
-                            if (dfac(j, n, m))
-                              {
-                                double fac = (i ? -1 : 1) * vfd(fb, e != f_e(fb, 0)) * dfac(j, n, m) / ve(e);
-                                if (fd >= 0)
-                                  secmem(fb, n) -= fac * mult * inco(fd, m); //autre face calculee
-                                else
-                                  for (d = 0; d < D; d++)  //CL de Dirichlet
-                                    secmem(fb, n) -= fac * nf(fb, d) / fs(fb) * ref_cast(Dirichlet, cls[fcl(f, 1)].valeur()).val_imp(fcl(f, 2), N * d + m);
-                                if (comp)
-                                  secmem(fb, n) += fac * inco(fb, m); //partie v div(alpha rho v)
-                                if (!mat)
-                                  continue;
-                                if (fd >= 0 && fcl(fd, 0) < 2)
-                                  (*mat)(N * fb + n, N * fd + m) += fac * mult;
-                                if (comp)
-                                  (*mat)(N * fb + n, N * fb + m) -= fac;
-                              }
-                      }
-                  else
-                    for (j = 0; j < 2; j++)
-                      for (eb = f_e(f, j), d = 0; d < D; d++)
-                        if (std::fabs(nf(fb, d)) > 1e-6 * fs(fb))
-                          for (n = 0; n < N; n++)
-                            for (m = 0; m < N; m++)
-                              if (dfac(j, n, m))
-                                {
-                                  //pas d'equivalence : mu_f * n_f * operateur aux elements
-                                  double fac = (i ? -1 : 1) * vfd(fb, e != f_e(fb, 0)) * dfac(j, n, m) / ve(e) * nf(fb, d) / fs(fb);
-                                  secmem(fb, n) -= fac * inco(nf_tot + D * eb + d, m);
-                                  if (comp)
-                                    secmem(fb, n) += fac * inco(nf_tot + D * e + d, m);
-                                  if (!mat || !fac)
-                                    continue;
-                                  (*mat)(N * fb + n, N * (nf_tot + D * eb + d) + m) += fac;
-                                  if (comp)
-                                    (*mat)(N * fb + n, N * (nf_tot + D * e + d) + m) -= fac;
-                                }
-                }
-            for (j = 0; j < 2; j++)
-              for (eb = f_e(f, j), d = 0; d < D; d++)
-                for (n = 0; n < N; n++)
-                  for (m = 0; m < N; m++)
-                    if (dfac(j, n, m)) //partie "elem"
-                      {
-                        double fac = (i ? -1 : 1) * dfac(j, n, m);
-                        secmem(nf_tot + D * e + d, n) -= fac * (eb >= 0 ? inco(nf_tot + D * eb + d, m) : ref_cast(Dirichlet, cls[fcl(f, 1)].valeur()).val_imp(fcl(f, 2), N * d + m));
+                        const double df = dfac_v(f_, (j * N + n_) * N + m_);
+                        if (!df) continue;
+                        const double fac = sgn * vfd_fb * df / ve_v(e_);
+                        double contrib = 0;
+                        if (fd >= 0)
+                          contrib -= fac * mult * inco_v(fd, m_); //autre face calculee
+                        else
+                          for (int d_ = 0; d_ < D; d_++)  //CL de Dirichlet
+                            contrib -= fac * nf_v(fb, d_) / fs_v(fb) * val_dir_v(f_, N * d_ + m_);
                         if (comp)
-                          secmem(nf_tot + D * e + d, n) += fac * inco(nf_tot + D * e + d, m); //partie v div(alpha rho v)
-                        if (!mat)
+                          contrib += fac * inco_v(fb, m_); //partie v div(alpha rho v)
+                        Kokkos::atomic_add(&secmem_v(fb, n_), contrib);
+                        if (!has_mat)
                           continue;
-                        if (eb >= 0)
-                          (*mat)(N * (nf_tot + D * e + d) + n, N * (nf_tot + D * eb + d) + m) += fac;
+                        if (fd >= 0 && fcl_v(fd, 0) < 2)
+                          ajouter_coeff_morse(tab1_v, tab2_v, coeff_v, nb_hors_stencil_v, N * fb + n_, N * fd + m_, fac * mult);
                         if (comp)
-                          (*mat)(N * (nf_tot + D * e + d) + n, N * (nf_tot + D * e + d) + m) -= fac;
+                          ajouter_coeff_morse(tab1_v, tab2_v, coeff_v, nb_hors_stencil_v, N * fb + n_, N * fb + m_, -fac);
                       }
+                }
+            else
+              for (int j = 0; j < 2; j++)
+                for (int eb_ = f_e_v(f_, j), d_ = 0; d_ < D; d_++)
+                  if (Kokkos::fabs(nf_v(fb, d_)) > 1e-6 * fs_v(fb))
+                    for (int n_ = 0; n_ < N; n_++)
+                      for (int m_ = 0; m_ < N; m_++)
+                        {
+                          const double df = dfac_v(f_, (j * N + n_) * N + m_);
+                          if (!df) continue;
+                          //pas d'equivalence : mu_f * n_f * operateur aux elements
+                          const double fac = sgn * vfd_fb * df / ve_v(e_) * nf_v(fb, d_) / fs_v(fb);
+                          double contrib = -fac * inco_v(nf_tot + D * eb_ + d_, m_);
+                          if (comp)
+                            contrib += fac * inco_v(nf_tot + D * e_ + d_, m_);
+                          Kokkos::atomic_add(&secmem_v(fb, n_), contrib);
+                          if (!has_mat || !fac)
+                            continue;
+                          ajouter_coeff_morse(tab1_v, tab2_v, coeff_v, nb_hors_stencil_v, N * fb + n_, N * (nf_tot + D * eb_ + d_) + m_, fac);
+                          if (comp)
+                            ajouter_coeff_morse(tab1_v, tab2_v, coeff_v, nb_hors_stencil_v, N * fb + n_, N * (nf_tot + D * e_ + d_) + m_, -fac);
+                        }
           }
+        for (int j = 0; j < 2; j++)
+          for (int eb_ = f_e_v(f_, j), d_ = 0; d_ < D; d_++)
+            for (int n_ = 0; n_ < N; n_++)
+              for (int m_ = 0; m_ < N; m_++)
+                {
+                  const double df = dfac_v(f_, (j * N + n_) * N + m_);
+                  if (!df) continue; //partie "elem"
+                  const double fac = sgn * df;
+                  double contrib = -fac * (eb_ >= 0 ? inco_v(nf_tot + D * eb_ + d_, m_) : val_dir_v(f_, N * d_ + m_));
+                  if (comp)
+                    contrib += fac * inco_v(nf_tot + D * e_ + d_, m_); //partie v div(alpha rho v)
+                  Kokkos::atomic_add(&secmem_v(nf_tot + D * e_ + d_, n_), contrib);
+                  if (!has_mat)
+                    continue;
+                  if (eb_ >= 0)
+                    ajouter_coeff_morse(tab1_v, tab2_v, coeff_v, nb_hors_stencil_v, N * (nf_tot + D * e_ + d_) + n_, N * (nf_tot + D * eb_ + d_) + m_, fac);
+                  if (comp)
+                    ajouter_coeff_morse(tab1_v, tab2_v, coeff_v, nb_hors_stencil_v, N * (nf_tot + D * e_ + d_) + n_, N * (nf_tot + D * e_ + d_) + m_, -fac);
+                }
       }
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Face loop in Op_Conv_EF_Stab_PolyMAC_P0_Face::ajouter_blocs", nf_tot, kern_ajouter_blocs);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Face loop in Op_Conv_EF_Stab_PolyMAC_P0_Face::ajouter_blocs");
+
+  if (nb_hors_stencil(0))
+    {
+      Cerr << "Op_Conv_EF_Stab_PolyMAC_P0_Face::ajouter_blocs : " << nb_hors_stencil(0) << " coefficients outside of the matrix stencil!" << finl;
+      Process::exit();
+    }
   statistiques().end_count(convection_counter_);
 }
@@ -37,6 +37,7 @@
 #include <Array_tools.h>
 #include <TRUSTLists.h>
 #include <Dirichlet.h>
+#include <Device.h>
 #include <functional>
 #include <cmath>
 
@@ -329,38 +330,65 @@ void Op_Diff_PolyMAC_P0_Elem::ajouter_blocs(matrices_t matrices, DoubleTab& secm
   d_nuc_ = 0; //remise a zero du diametre de nucleation
 
   /* avec phif : flux hors Echange_contact -> mat[0] seulement */
-  DoubleTrav flux(N[0]);
-  for (f = 0; f < domaine0.nb_faces(); f++)
+  /* valeurs imposees aux bords, rangees par face pour que la boucle sur les faces ne lise que des tableaux */
+  DoubleTrav val_b(domaine0.nb_faces_tot(), N[0]);
+  for (f = 0; f < domaine0.nb_faces_tot(); f++)
+    if (fcl[0](f, 0) == 1 || fcl[0](f, 0) == 2)
+      for (n = 0; n < N[0]; n++) //Echange_impose_base
+        val_b(f, n) = ref_cast(Echange_impose_base, cls[0].get()[fcl[0](f, 1)].valeur()).T_ext(fcl[0](f, 2), n);
+    else if (fcl[0](f, 0) == 4)
+      for (n = 0; n < N[0]; n++) //Neumann non homogene
+        val_b(f, n) = ref_cast(Neumann_paroi, cls[0].get()[fcl[0](f, 1)].valeur()).flux_impose(fcl[0](f, 2), n);
+    else if (fcl[0](f, 0) == 6)
+      for (n = 0; n < N[0]; n++) //Dirichlet
+        val_b(f, n) = ref_cast(Dirichlet, cls[0].get()[fcl[0](f, 1)].valeur()).val_imp(fcl[0](f, 2), n);
+
+  {
+    const int ne = domaine0.nb_elem(), ne_tot = domaine0.nb_elem_tot(), premiere_face_int = domaine0.premiere_face_int(), N0 = N[0];
+    CIntTabView f_e_v = f_e[0].get().view_ro(), fcl_v = fcl[0].get().view_ro(), phif_d_v = phif_d.view_ro(), phif_e_v = phif_e.view_ro();
+    CDoubleTabView phif_c_v = phif_c.view_ro(), inco_v = inco[0].get().view_ro(), val_b_v = val_b.view_ro();
+    CDoubleArrView fs_v = fs[0].get().view_ro();
+    DoubleTabView secmem_v = secmem.view_rw(), flux_bords_v = flux_bords_.view_rw();
+
+    // un element recoit le flux de toutes ses faces -> atomic_add
+    auto kern_flux = KOKKOS_LAMBDA(int fa)
     {
-      for (flux = 0, i = phif_d(f); i < phif_d(f + 1); i++)
-        if ((fb = (eb = phif_e(i)) - domaine0.nb_elem_tot()) < 0) //element
-          {
-            for (n = 0; n < N[0]; n++)
-              flux(n) += phif_c(i, n) * fs[0](f) * inco[0](eb, n);
-            if (mat[0])
-              for (j = 0; j < 2 && (e = f_e[0](f, j)) >= 0; j++)
-                if (e < domaine[0].get().nb_elem())
-                  for (n = 0; n < N[0]; n++) //derivees
-                    (*mat[0])(N[0] * e + n, N[0] * eb + n) += (j ? 1 : -1) * phif_c(i, n) * fs[0](f);
-          }
-        else if (fcl[0](fb, 0) == 1 || fcl[0](fb, 0) == 2)
-          for (n = 0; n < N[0]; n++) //Echange_impose_base
-            flux(n) += (phif_c(i, n) ? phif_c(i, n) * fs[0](f) * ref_cast(Echange_impose_base, cls[0].get()[fcl[0](fb, 1)].valeur()).T_ext(fcl[0](fb, 2), n) : 0);
-        else if (fcl[0](fb, 0) == 4)
-          for (n = 0; n < N[0]; n++) //Neumann non homogene
-            flux(n) += (phif_c(i, n) ? phif_c(i, n) * fs[0](f) * ref_cast(Neumann_paroi, cls[0].get()[fcl[0](fb, 1)].valeur()).flux_impose(fcl[0](fb, 2), n) : 0);
-        else if (fcl[0](fb, 0) == 6)
-          for (n = 0; n < N[0]; n++) //Dirichlet
-            flux(n) += (phif_c(i, n) ? phif_c(i, n) * fs[0](f) * ref_cast(Dirichlet, cls[0].get()[fcl[0](fb, 1)].valeur()).val_imp(fcl[0](fb, 2), n) : 0);
-
-      for (j = 0; j < 2 && (e = f_e[0](f, j)) >= 0; j++)
-        if (e < domaine[0].get().nb_elem())
-          for (n = 0; n < N[0]; n++) //second membre -> amont/aval
-            secmem(e, n) += (j ? -1 : 1) * flux(n);
-      if (f < domaine0.premiere_face_int())
-        for (n = 0; n < N[0]; n++)
-          flux_bords_(f, n) = flux(n); //flux aux bords
-    }
+      for (int c = 0; c < N0; c++)
+        {
+          double flux = 0;
+          for (int ii = phif_d_v(fa, 0); ii < phif_d_v(fa + 1, 0); ii++)
+            {
+              const int el = phif_e_v(ii, 0), fd = el - ne_tot, t = fd < 0 ? -1 : fcl_v(fd, 0);
+              const double coef = phif_c_v(ii, c);
+              if (fd < 0) //element
+                flux += coef * fs_v(fa) * inco_v(el, c);
+              else if ((t == 1 || t == 2 || t == 4 || t == 6) && coef) //Echange_impose_base, Neumann non homogene, Dirichlet
+                flux += coef * fs_v(fa) * val_b_v(fd, c);
+            }
+          for (int jj = 0; jj < 2; jj++) //second membre -> amont/aval
+            {
+              const int el = f_e_v(fa, jj);
+              if (el < 0) break;
+              if (el < ne)
+                Kokkos::atomic_add(&secmem_v(el, c), jj ? -flux : flux);
+            }
+          if (fa < premiere_face_int)
+            flux_bords_v(fa, c) = flux; //flux aux bords
+        }
+    };
+    start_gpu_timer();
+    Kokkos::parallel_for("[KOKKOS] Face loop in Op_Diff_PolyMAC_P0_Elem::ajouter_blocs", domaine0.nb_faces(), kern_flux);
+    end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Face loop in Op_Diff_PolyMAC_P0_Elem::ajouter_blocs");
+  }
+
+  if (mat[0]) //derivees
+    for (f = 0; f < domaine0.nb_faces(); f++)
+      for (i = phif_d(f); i < phif_d(f + 1); i++)
+        if ((eb = phif_e(i)) < domaine0.nb_elem_tot())
+          for (j = 0; j < 2 && (e = f_e[0](f, j)) >= 0; j++)
+            if (e < domaine[0].get().nb_elem())
+              for (n = 0; n < N[0]; n++)
+                (*mat[0])(N[0] * e + n, N[0] * eb + n) += (j ? 1 : -1) * phif_c(i, n) * fs[0](f);
 
   /* avec som_ext : flux autour des sommets affectes par des Echange_contact */
   double vol_s, i3[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } }, eps = 1e-8, eps_g = 1e-6, fac[3];
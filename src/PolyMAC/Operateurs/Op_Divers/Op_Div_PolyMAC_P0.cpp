@@ -23,6 +23,7 @@
 #include <Matrice_Morse.h>
 #include <Matrix_tools.h>
 #include <Array_tools.h>
+#include <Device.h>
 
 Implemente_instanciable(Op_Div_PolyMAC_P0, "Op_Div_PolyMAC_P0", Op_Div_PolyMAC_P0P1NC);
 
@@ -61,22 +62,37 @@ DoubleTab& Op_Div_PolyMAC_P0::ajouter(const DoubleTab& vit, DoubleTab& div) cons
   const Domaine_PolyMAC_P0& domaine = ref_cast(Domaine_PolyMAC_P0, le_dom_PolyMAC.valeur());
   const DoubleVect& fs = domaine.face_surfaces(), &pf = equation().milieu().porosite_face();
   const IntTab& f_e = domaine.face_voisins();
-  int i, e, f, n, N = vit.line_size();
+  int nb_faces = domaine.nb_faces(), premiere_face_int = domaine.premiere_face_int(), N = vit.line_size();
   assert(div.line_size() == N);
 
   DoubleTab& tab_flux_bords = flux_bords_;
   tab_flux_bords.resize(domaine.nb_faces_bord(), 1);
   tab_flux_bords = 0;
 
-  for (f = 0; f < domaine.nb_faces(); f++)
-    {
-      for (i = 0; i < 2 && (e = f_e(f, i)) >= 0; i++)
-        for (n = 0; n < N; n++)
-          div(e, n) += (i ? -1 : 1) * fs(f) * pf(f) * vit(f, n);
-      if (f < domaine.premiere_face_int())
-        for (n = 0; n < N; n++)
-          tab_flux_bords(f, n) = fs(f) * pf(f) * vit(f, n);
-    }
+  CIntTabView f_e_v = f_e.view_ro();
+  CDoubleArrView fs_v = fs.view_ro(), pf_v = pf.view_ro();
+  CDoubleTabView vit_v = vit.view_ro();
+  DoubleTabView div_v = div.view_rw(), flux_bords_v = tab_flux_bords.view_rw();
+
+  // Boucle sur les faces : un element est partage par plusieurs faces -> atomic_add
+  auto kern_ajouter = KOKKOS_LAMBDA(int f)
+  {
+    for (int n = 0; n < N; n++)
+      {
+        double flux = fs_v(f) * pf_v(f) * vit_v(f, n);
+        for (int i = 0; i < 2; i++)
+          {
+            int e = f_e_v(f, i);
+            if (e < 0) break;
+            Kokkos::atomic_add(&div_v(e, n), i ? -flux : flux);
+          }
+        if (f < premiere_face_int)
+          flux_bords_v(f, n) = flux;
+      }
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Face loop in Op_Div_PolyMAC_P0::ajouter", nb_faces, kern_ajouter);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Face loop in Op_Div_PolyMAC_P0::ajouter");
 
   div.echange_espace_virtuel();
 
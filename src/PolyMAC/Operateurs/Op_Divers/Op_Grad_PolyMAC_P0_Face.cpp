@@ -28,6 +28,7 @@
 #include <Milieu_base.h>
 #include <Periodique.h>
 #include <TRUSTTrav.h>
+#include <Device.h>
 
 extern Stat_Counter_Id gradient_counter_;
 
@@ -190,6 +191,14 @@ void Op_Grad_PolyMAC_P0_Face::ajouter_blocs(matrices_t matrices, DoubleTab& secm
   for (f = 0; f < domaine.nb_faces(); f++)
     if (fgrad_d(f + 1) == fgrad_d(f))
       abort();
+
+  if (!mat_p && !mat_v) //cas explicite : pas de derivees -> boucle sur les faces en parallele
+    {
+      ajouter_blocs_explicite(press, alp, gb, secmem);
+      statistiques().end_count(gradient_counter_);
+      return;
+    }
+
   /* aux faces */
   std::vector<std::map<int, double>> dgf_pe(N), dgf_gb(N); //dependance de [grad p]_f en les pressions aux elements, en les grad p aux faces de bord
   for (f = 0; f < domaine.nb_faces_tot(); f++)
@@ -249,3 +258,67 @@ void Op_Grad_PolyMAC_P0_Face::ajouter_blocs(matrices_t matrices, DoubleTab& secm
 
   statistiques().end_count(gradient_counter_);
 }
+
+/* partie explicite de ajouter_blocs() : gb contient deja -grad p aux faces de Dirichlet/Symetrie */
+void Op_Grad_PolyMAC_P0_Face::ajouter_blocs_explicite(const DoubleTab& press, const DoubleTab *alp, DoubleTab& gb, DoubleTab& secmem) const
+{
+  const Domaine_PolyMAC_P0& domaine = ref_cast(Domaine_PolyMAC_P0, ref_domaine.valeur());
+  const Champ_Face_PolyMAC_P0& ch = ref_cast(Champ_Face_PolyMAC_P0, equation().inconnue().valeur());
+  const Conds_lim& cls = ref_zcl->les_conditions_limites();
+  const IntTab& f_e = domaine.face_voisins(), &fcl = ch.fcl();
+  const DoubleTab& xp = domaine.xp(), &xv = domaine.xv(), &vfd = domaine.volumes_entrelaces_dir();
+  const DoubleVect& fs = domaine.face_surfaces(), &ve = domaine.volumes(), &pe = equation().milieu().porosite_elem(), &pf = equation().milieu().porosite_face();
+  int ne = domaine.nb_elem(), ne_tot = domaine.nb_elem_tot(), nf = domaine.nb_faces(), nf_tot = domaine.nb_faces_tot(), D = dimension, N = secmem.line_size(), M = press.line_size(), has_alp = alp != nullptr;
+
+  /* Neumann : le flux impose est range dans gb pour que le noyau ne lise que des tableaux */
+  for (int f = 0; f < nf_tot; f++)
+    if (fcl(f, 0) == 1)
+      for (int m = 0; m < M; m++)
+        gb(f, m) = ref_cast(Neumann, cls[fcl(f, 1)].valeur()).flux_impose(fcl(f, 2), m);
+
+  CIntTabView f_e_v = f_e.view_ro(), fcl_v = fcl.view_ro(), fgrad_d_v = fgrad_d.view_ro(), fgrad_e_v = fgrad_e.view_ro();
+  CDoubleTabView xp_v = xp.view_ro(), xv_v = xv.view_ro(), vfd_v = vfd.view_ro(), press_v = press.view_ro(), gb_v = gb.view_ro(), fgrad_c_v = fgrad_c.view_ro(),
+                 alp_v = (has_alp ? *alp : press).view_ro();
+  CDoubleArrView fs_v = fs.view_ro(), ve_v = ve.view_ro(), pe_v = pe.view_ro(), pf_v = pf.view_ro();
+  DoubleTabView secmem_v = secmem.view_rw();
+
+  // Les lignes des faces sont propres a chaque face ; les lignes des elements sont partagees -> atomic_add
+  auto kern_ajouter = KOKKOS_LAMBDA(int f)
+  {
+    for (int n = 0, m = 0; n < N; n++, m += (M > 1))
+      {
+        double a_v = 0, gf = 0; //produit alpha * vol, |f| grad p
+        for (int i = 0; i < 2; i++)
+          {
+            int e = f_e_v(f, i);
+            if (e < 0) break;
+            a_v += vfd_v(f, i) * (has_alp ? alp_v(e, n) : 1);
+          }
+        for (int i = fgrad_d_v(f, 0); i < fgrad_d_v(f + 1, 0); i++)
+          {
+            int e = fgrad_e_v(i, 0);
+            gf += fgrad_c_v(i, m) * (e < ne_tot ? press_v(e, m) : gb_v(e - ne_tot, m));
+          }
+
+        /* face -> vf(f) * phi grad p */
+        if (fcl_v(f, 0) < 2 && f < nf)
+          secmem_v(f, n) -= a_v * pf_v(f) * gf;
+        /* elems amont/aval -> ve(e) * phi grad p */
+        for (int i = 0; i < 2; i++)
+          {
+            int e = f_e_v(f, i);
+            if (e < 0) break;
+            if (e < ne)
+              for (int d = 0; d < D; d++)
+                if (fs_v(f) * Kokkos::fabs(xv_v(f, d) - xp_v(e, d)) > 1e-6 * ve_v(e))
+                  {
+                    double fac = (i ? -1 : 1) * fs_v(f) * pe_v(e) * (xv_v(f, d) - xp_v(e, d)) * (has_alp ? alp_v(e, n) : 1);
+                    Kokkos::atomic_add(&secmem_v(nf_tot + D * e + d, n), -fac * gf);
+                  }
+          }
+      }
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Face loop in Op_Grad_PolyMAC_P0_Face::ajouter_blocs", nf_tot, kern_ajouter);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Face loop in Op_Grad_PolyMAC_P0_Face::ajouter_blocs");
+}
@@ -43,6 +43,8 @@ public:
   mutable DoubleTab fgrad_c;
 
 private:
+  void ajouter_blocs_explicite(const DoubleTab& press, const DoubleTab *alp, DoubleTab& gb, DoubleTab& secmem) const;
+
   mutable double last_gradp_ = -DBL_MAX; //dernier temps utilise pour interpoler grad p (mis a DBL_MAX si grad p non reinterpole)
 };
 
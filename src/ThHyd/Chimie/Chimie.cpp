@@ -23,6 +23,8 @@
 #include <Convection_Diffusion_Concentration.h>
 #include <dlsinterf.h>
 #include <Constituant.h>
+#include <TRUSTTrav.h>
+#include <Device.h>
 
 Implemente_instanciable(Chimie,"Chimie",Objet_U);
 
@@ -40,7 +42,17 @@ Entree& Chimie::readOn(Entree& is)
   param.ajouter("modele_micro_melange",&modele_micro_melange_);
   param.ajouter("constante_modele_micro_melange",&constante_modele_micro_melange_);
   param.ajouter("espece_en_competition_micro_melange",&espece_en_competition_micro_melange_);
+  param.ajouter("integrateur",&integrateur_);
+  param.dictionnaire("dlsode",0);
+  param.dictionnaire("rosenbrock",1);
+  param.ajouter("atol",&atol_rosenbrock_);
+  param.ajouter("rtol",&rtol_rosenbrock_);
   param.lire_avec_accolades_depuis(is);
+  if (atol_rosenbrock_ <= 0. || rtol_rosenbrock_ < 0.)
+    {
+      Cerr << "Chimie : atol must be strictly positive and rtol positive" << finl;
+      exit();
+    }
   return is;
 
 }
@@ -238,6 +250,10 @@ void  Chimie::mettre_a_jour(double temps)
           ArrOfDouble pstochio(nbc);
           ArrOfInt pactivite(nbc);
           F77NAME(SETMARQUEUR)(&marqueur_espece_en_competition_micro_melange_);
+          // copie des donnees du common pour l'integrateur par lot
+          DoubleTab stoechio(nbrtot,nbc);
+          IntTab activite(nbrtot,nbc);
+          ArrOfDouble cw_r(nbrtot);
           for (int i=0; i<nbrtot; i++)
             {
               int ir=marq_contre[i];
@@ -264,6 +280,9 @@ void  Chimie::mettre_a_jour(double temps)
               int avec_contre_reaction=(reaction.contre_reaction_>0);
               F77NAME(INITREACTIONCOMMON)(&(ii), pstochio.addr(), pactivite.addr(),&avec_contre_reaction) ;
               F77NAME(SETCWREACTION)(&(ii), &cw);
+              for (int ic=0; ic<nbc; ic++)
+                stoechio(i,ic)=pstochio[ic], activite(i,ic)=pactivite[ic];
+              cw_r[i]=cw;
 
             }
           // F77NAME(PRINT_COMMON)();
@@ -310,11 +329,35 @@ void  Chimie::mettre_a_jour(double temps)
               tau_mel.echange_espace_virtuel();
             }
           int nb_elem=liste_C_[0].valeur().valeurs().size();
-          ArrOfDouble C(nbc);
+          DoubleTrav C_elem(nb_elem,nbc);
+          // recuperation des valeurs initiales
+          for (int elem=0; elem<nb_elem; elem++)
+            for (int i=0; i<nbc; i++)
+              {
+                double c=liste_C_[i].valeur().valeurs()(elem);
+                if (c<0)
+                  {
+                    if (c<-1e-5)
+                      {
+                        Cerr<<" on rabote C_"<<i<<" dans la maille "<<elem<<" dans la chimie !!!!!! "<<c<<finl;
+                        exit();
+                      }
+                    c=0;
+                  }
+                C_elem(elem,i)=c;
+              }
+
+          // mailles a integrer par dlsode : toutes, sauf celles traitees par l'integrateur par lot
+          // (le micro-melange modifie les taux de facon non analytique, on reste alors sur dlsode)
+          IntTrav echec(nb_elem);
+          echec=1;
+          if (integrateur_==1 && modele_micro_melange_==0)
+            integrer_rosenbrock(C_elem,stoechio,activite,cw_r,dt,echec);
 
+          ArrOfDouble C(nbc);
           for (int elem=0; elem<nb_elem; elem++)
             {
-
+              if (!echec(elem)) continue;
               double tau_melange=-1;
               if (modele_micro_melange_>0)
                 {
@@ -329,40 +372,24 @@ void  Chimie::mettre_a_jour(double temps)
                     }
                 }
               // tau_melange <0 pas pris en compte
-              // recuperation des valeurs initiales
-              for (int i=0; i<nbc; i++)
-                {
-                  C[i]=liste_C_[i].valeur().valeurs()(elem);
-
-                }
               for (int i=0; i<nbc; i++)
-                {
-                  if (C[i]<0)
-                    {
-                      if (C[i]<-1e-5)
-                        {
-                          Cerr<<" on rabote C_"<<i<<" dans la maille "<<elem<<" dans la chimie !!!!!! "<<C[i]<<finl;
-                          exit();
-                        }
-                      C[i]=0;
-                    }
-                }
-              int init=1;
-              if (init)
-                {
-
-                }
+                C[i]=C_elem(elem,i);
               double t=0,tout=dt;
               int itol=1;
               double rtol=0;
               double atol=1e-10;
               F77NAME(DLSODECHIMIES)(&nbc, C.addr(),&t, &tout,&tau_melange, &itol, &rtol, &atol, rwork.addr(), &lrw, iwork.addr(), &liw);
-              // mise a jour des inconnues
-              for (int i=0; i<liste_C_.size(); i++)
-                liste_C_[i].valeur().valeurs()(elem)=C[i];
+              for (int i=0; i<nbc; i++)
+                C_elem(elem,i)=C[i];
             }
+          // mise a jour des inconnues
           for (int i=0; i<liste_C_.size(); i++)
-            liste_C_[i].valeur().valeurs().echange_espace_virtuel();
+            {
+              DoubleTab& Ci=liste_C_[i].valeur().valeurs();
+              for (int elem=0; elem<nb_elem; elem++)
+                Ci(elem)=C_elem(elem,i);
+              Ci.echange_espace_virtuel();
+            }
           return;
         }
       // on calcule le nb_sous_pas_temps_max
@@ -570,3 +597,171 @@ int Chimie::reprendre(Entree& is)
   return 1;
 }
 
+
+// nombre maximal d'especes, identique a ncmax du common Fortran (common_chimie.def)
+static constexpr int NB_ESPECES_MAX = 12;
+
+// taux de production f(y) = - sum_r stoechio(r,.) cw(r) prod_c y_c^activite(r,c) (cf f_chim)
+KOKKOS_INLINE_FUNCTION void taux_chimie(const CDoubleTabView& sto, const CIntTabView& act, const CDoubleArrView& cw, int nbr, int nbc, const double *y, double *f)
+{
+  for (int c = 0; c < nbc; c++) f[c] = 0;
+  for (int r = 0; r < nbr; r++)
+    {
+      double w = -cw(r);
+      for (int c = 0; c < nbc; c++)
+        for (int p = 0; p < act(r, c); p++) w *= y[c];
+      if (w != 0)
+        for (int c = 0; c < nbc; c++) f[c] += sto(r, c) * w;
+    }
+}
+
+// a = Id - gh * df/dy, jacobienne analytique (cf jac_chim)
+KOKKOS_INLINE_FUNCTION void matrice_rosenbrock(const CDoubleTabView& sto, const CIntTabView& act, const CDoubleArrView& cw, int nbr, int nbc, const double *y, double gh, double *a)
+{
+  for (int i = 0; i < nbc; i++)
+    for (int j = 0; j < nbc; j++) a[i * nbc + j] = (i == j);
+  for (int r = 0; r < nbr; r++)
+    for (int j = 0; j < nbc; j++)
+      if (act(r, j))
+        {
+          double w = -cw(r) * act(r, j);
+          for (int c = 0; c < nbc; c++)
+            for (int p = 0; p < act(r, c) - (c == j); p++) w *= y[c];
+          if (w != 0)
+            for (int i = 0; i < nbc; i++) a[i * nbc + j] -= gh * sto(r, i) * w;
+        }
+}
+
+// factorisation LU en place avec pivot partiel ; renvoie 0 si la matrice est singuliere
+KOKKOS_INLINE_FUNCTION int factoriser_lu(int n, double *a, int *piv)
+{
+  for (int k = 0; k < n; k++)
+    {
+      int p = k;
+      for (int i = k + 1; i < n; i++)
+        if (Kokkos::fabs(a[i * n + k]) > Kokkos::fabs(a[p * n + k])) p = i;
+      piv[k] = p;
+      if (a[p * n + k] == 0) return 0;
+      if (p != k)
+        for (int j = 0; j < n; j++)
+          {
+            const double tmp = a[k * n + j];
+            a[k * n + j] = a[p * n + j], a[p * n + j] = tmp;
+          }
+      for (int i = k + 1; i < n; i++)
+        {
+          const double l = a[i * n + k] /= a[k * n + k];
+          for (int j = k + 1; j < n; j++) a[i * n + j] -= l * a[k * n + j];
+        }
+    }
+  return 1;
+}
+
+KOKKOS_INLINE_FUNCTION void resoudre_lu(int n, const double *a, const int *piv, double *x)
+{
+  for (int k = 0; k < n; k++)
+    {
+      const double tmp = x[k];
+      x[k] = x[piv[k]], x[piv[k]] = tmp;
+      for (int i = k + 1; i < n; i++) x[i] -= a[i * n + k] * x[k];
+    }
+  for (int k = n - 1; k >= 0; k--)
+    {
+      for (int j = k + 1; j < n; j++) x[k] -= a[k * n + j] * x[j];
+      x[k] /= a[k * n + k];
+    }
+}
+
+/*! @brief Integre la cinetique chimique sur dt pour toutes les mailles a la fois.
+ *
+ * Schema de Rosenbrock ROS2 (L-stable, ordre 2) a pas adaptatif, l'erreur etant estimee par l'ecart avec
+ *  le schema d'Euler lineairement implicite. La jacobienne est analytique (loi d'action de masse).
+ *  Les mailles chimiquement figees (variation sur dt inferieure a atol) ne sont pas integrees.
+ *  Un pas qui rend une concentration negative au-dela de atol + rtol * |y| est rejete et h est divise par 5 ;
+ *  les depassements plus faibles sont ramenes a zero.
+ *  Les mailles ou l'integration echoue gardent C intact et echec(e)=1 : elles sont alors confiees a dlsode.
+ */
+void Chimie::integrer_rosenbrock(DoubleTab& C, const DoubleTab& stoechio, const IntTab& activite, const ArrOfDouble& cw, double dt, IntTab& echec) const
+{
+  const int nb_elem = C.dimension(0), nbc = C.dimension(1), nbr = stoechio.dimension(0);
+  if (nbc > NB_ESPECES_MAX)
+    {
+      Cerr << "Chimie : integrateur rosenbrock limite a " << NB_ESPECES_MAX << " especes" << finl;
+      exit();
+    }
+  const double atol = atol_rosenbrock_, rtol = rtol_rosenbrock_, gam = 1. + 1. / sqrt(2.);
+  const int nb_pas_max = 10000;
+
+  CDoubleTabView sto = stoechio.view_ro();
+  CIntTabView act = activite.view_ro();
+  CDoubleArrView cw_v = cw.view_ro();
+  DoubleTabView C_v = C.view_rw();
+  IntTabView echec_v = echec.view_rw();
+
+  auto kern = KOKKOS_LAMBDA(int e)
+  {
+    double y[NB_ESPECES_MAX], f[NB_ESPECES_MAX], k1[NB_ESPECES_MAX], k2[NB_ESPECES_MAX], y1[NB_ESPECES_MAX], a[NB_ESPECES_MAX * NB_ESPECES_MAX];
+    int piv[NB_ESPECES_MAX];
+    for (int c = 0; c < nbc; c++) y[c] = C_v(e, c);
+    taux_chimie(sto, act, cw_v, nbr, nbc, y, f);
+
+    double t = 0, h = dt;
+    int nb_pas = 0, ok = 1;
+    while (ok)
+      {
+        // maille figee sur le reste du pas de temps ?
+        double df = 0;
+        for (int c = 0; c < nbc; c++) df = Kokkos::fmax(df, Kokkos::fabs(f[c]));
+        if ((dt - t) * df <= atol) break;
+        if (nb_pas++ == nb_pas_max)
+          {
+            ok = 0;
+            break;
+          }
+        h = Kokkos::fmin(h, dt - t);
+
+        matrice_rosenbrock(sto, act, cw_v, nbr, nbc, y, gam * h, a);
+        if (!factoriser_lu(nbc, a, piv))
+          {
+            ok = 0;
+            break;
+          }
+        for (int c = 0; c < nbc; c++) k1[c] = f[c];
+        resoudre_lu(nbc, a, piv, k1);
+        for (int c = 0; c < nbc; c++) y1[c] = y[c] + h * k1[c];
+        taux_chimie(sto, act, cw_v, nbr, nbc, y1, k2);
+        for (int c = 0; c < nbc; c++) k2[c] -= 2 * k1[c];
+        resoudre_lu(nbc, a, piv, k2);
+
+        // solution d'ordre 2 dans y1 ; une concentration negative au-dela de la tolerance rejette le pas
+        double err = 0;
+        int negatif = 0;
+        for (int c = 0; c < nbc; c++)
+          {
+            const double tol = atol + rtol * Kokkos::fabs(y[c]);
+            err = Kokkos::fmax(err, Kokkos::fabs(0.5 * h * (k1[c] + k2[c])) / tol);
+            y1[c] = y[c] + h * (1.5 * k1[c] + 0.5 * k2[c]);
+            if (y1[c] < -tol) negatif = 1;
+          }
+        if (negatif)
+          {
+            h *= 0.2;
+            continue;
+          }
+        if (err <= 1)
+          {
+            // ecart negatif dans la tolerance ou valeur infime : ramene a zero (comme dlsodechimies)
+            for (int c = 0; c < nbc; c++) y[c] = y1[c] < 1e-37 ? 0 : y1[c];
+            t += h;
+            taux_chimie(sto, act, cw_v, nbr, nbc, y, f);
+          }
+        h *= Kokkos::fmin(5., Kokkos::fmax(0.2, 0.9 / Kokkos::sqrt(Kokkos::fmax(err, 1e-10))));
+      }
+    if (ok)
+      for (int c = 0; c < nbc; c++) C_v(e, c) = y[c];
+    echec_v(e, 0) = !ok;
+  };
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Chimie::integrer_rosenbrock", nb_elem, kern);
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Chimie::integrer_rosenbrock");
+}
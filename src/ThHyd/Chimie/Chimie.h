@@ -45,6 +45,8 @@ public:
   int reprendre(Entree& ) override;
 
 protected:
+  void integrer_rosenbrock(DoubleTab& C, const DoubleTab& stoechio, const IntTab& activite, const ArrOfDouble& cw, double dt, IntTab& echec) const;
+
   LIST(Reaction) reactions_;
   REF(Probleme_base) pb_;
   Motcles alias;
@@ -55,5 +57,7 @@ protected:
   double constante_modele_micro_melange_=-1.0;
   Motcle espece_en_competition_micro_melange_;
   int marqueur_espece_en_competition_micro_melange_ = -1;
+  int integrateur_ = 0; // 0 : dlsode maille par maille, 1 : Rosenbrock par lot
+  double atol_rosenbrock_ = 1e-10, rtol_rosenbrock_ = 1e-4; // tolerances absolue et relative de l'integrateur Rosenbrock
 };
 #endif
@@ -64,7 +64,7 @@ const Champ_base& Champ_Generique_modifier_pour_QC::get_champ_without_evaluation
 const Champ_base& Champ_Generique_modifier_pour_QC::get_champ(Champ& espace_stockage) const
 {
   Champ source_espace_stockage;
-  const Champ_base& source = get_source(0).get_champ(source_espace_stockage);
+  const Champ_base& source = get_source(0).get_champ_memorise(source_espace_stockage);
   Nature_du_champ nature_source = source.nature_du_champ();
   int nb_comp = source.nb_comp();
   Champ_Fonc es_tmp;
@@ -21,6 +21,7 @@
 #include <Fluide_base.h>
 #include <Champ_Uniforme.h>
 #include <Schema_Temps.h>
+#include <Device.h>
 
 #include <random>
 
@@ -57,9 +58,69 @@ int Champ_front_synt::initialiser(double tps, const Champ_Inc_base& inco)
   ref_inco_ = inco;
   temps_d_avant_ = tps;
 
+  // La geometrie de la frontiere ne change pas : centres des faces et taille de maille caracteristique calcules une seule fois
+  const Front_VF& front = ref_cast(Front_VF,la_frontiere_dis.valeur());
+  int nb_face = front.nb_faces(); // real only
+  const Faces& tabFaces = front.frontiere().faces();
+
+  DoubleVect aireFaces; // Attention : contains real + virtual faces
+  tabFaces.calculer_surfaces(aireFaces);
+  double sum_aire=0.;
+  for(int i=0; i<nb_face; i++)
+    sum_aire += aireFaces[i];
+  double nb_face_tot = nb_face;
+  mpsum_multiple(sum_aire, nb_face_tot);
+  dmin_ = sqrt( sum_aire / nb_face_tot ) ; // on prend la racine de l'aire moyenne des faces d'entree pour avoir une taille de maille caracteristique
+
+  tabFaces.calculer_centres_gravite(centres_faces_);
+
+  modes_.resize(nbModes, 7);
+  visc_spectre_ = -1.;
   return 1;
 }
 
+/*! @brief Calcul des nombres d'onde et des amplitudes (spectre de von Karman) des modes. Ne depend que des parametres
+ *
+ *  du jeu de donnees, du maillage et de la viscosite : on ne le refait que si la viscosite change.
+ *
+ */
+void Champ_front_synt::calculer_spectre(double visc)
+{
+  /////////////////////////////////////////////
+  /// valeurs remarquables du nombre d'onde ///
+  /////////////////////////////////////////////
+
+  double kappa_max = (pi/dmin_)*ratioCutoffWavenumber; // plus grand nombre d'onde (depend du maillage)
+  double kappa_e = 9*pi*amp/(55*lenghtScale); // pic d'energie
+  double kappa_eta = pow((turbDissRate/(visc*visc*visc)),0.25); // nombre d'onde de Kolmogorov
+  double kappa_min = kappa_e / KeOverKmin; // plus petit nombre d'onde
+  //double delta_kappa = (min(kappa_eta,kappa_max) - kappa_min) / nbModes; // repartition lineaire des modes => pas bon
+  double delta_kappa = pow( (std::min(kappa_eta,kappa_max) / kappa_min ), 1./(nbModes-1.)); // repartition logarithmique des modes => OK
+  if (kappa_max <= kappa_min)
+    {
+      Cerr << "Error: kappa_max(=" << kappa_max << ") <= kappa_min(=" << kappa_min << ")" << finl;
+      Cerr << "You should either refine your mesh or increase the ratioCutoffWavenumber value in " << que_suis_je() << finl;
+      Process::exit();
+    }
+
+  DoubleVect kappa_face(nbModes+1);
+  kappa_center_.resize(nbModes);
+  spectre_.resize(nbModes);
+
+  //for(int i = 0; i< nbModes+1; i++) kappa_face(i) = kappa_min + delta_kappa*i; // repartition lineaire
+  for(int i = 0; i< nbModes+1; i++)
+    kappa_face(i) = kappa_min * pow(delta_kappa,i); // repartition logarithmique
+
+  for(int m = 0; m< nbModes; m++)
+    {
+      kappa_center_(m) = 1.0/2.0*(kappa_face(m+1)+kappa_face(m));
+      double dkn = kappa_face(m+1)- kappa_face(m);
+      double karman_spectrum = amp/kappa_e * (2.*turbKinEn/3.) * pow((kappa_center_(m)/kappa_e),4)/pow(1+pow(kappa_center_(m)/kappa_e, 2),17.0/6.0) * exp(-2*(pow(kappa_center_(m)/kappa_eta, 2)));
+      spectre_(m) = 2*sqrt(karman_spectrum * dkn);
+    }
+  visc_spectre_ = visc;
+}
+
 
 /*! @brief Lecture a partir d'un flot d'entree au format: nombre_de_composantes
  *
@@ -254,159 +315,70 @@ void Champ_front_synt::mettre_a_jour(double temps)
   ////////////////////////////////////////////
 
   double visc = ref_cast(Fluide_base,mil).viscosite_cinematique().valeur()(0,0);
-  const Front_VF& front = ref_cast(Front_VF,la_frontiere_dis.valeur());
-  int nb_face = front.nb_faces(); // real only
-  const Faces& tabFaces = front.frontiere().faces(); // recuperation des faces
+  if (visc != visc_spectre_)
+    calculer_spectre(visc);
 
   //Cerr << "We store : temps_d_avant_ = "<<temps_d_avant_<<finl;
   DoubleTab& tab_avant=valeurs_au_temps(temps_d_avant_);
   DoubleTab& tab=valeurs_au_temps(temps);
 
-  DoubleVect aireFaces; // Attention : contains real + virtual faces
-  tabFaces.calculer_surfaces(aireFaces);
-
-  double sum_aire=0.;
-  for(int i=0; i<nb_face; i++)
-    sum_aire += aireFaces[i];
-
-  sum_aire = mp_sum(sum_aire);
-  double dmin = sqrt( sum_aire / mp_sum(nb_face) ) ; // on prend la racine de l'aire moyenne des faces d'entree pour avoir une taille de maille caracteristique
-
-  //double Uref = 0.; // vitesse de reference = norme du vecteur moyenne
-  //for (int i=0; i<moyenne.size_reelle(); i++) Uref += moyenne(i)*moyenne(i);
-  //Uref = sqrt(Uref);
-
-  //double turbScale = turbIntensity * Uref; //urms=I*Uref
-  //double turbKinEn = 3./2. * (turbIntensity * Uref) * (turbIntensity * Uref); // evaluation de l'energie cinetique turbulente = 3/2*(I*Uref)^2
-  //double turbDissRate = pow(Cmu,0.75)*pow(turbKinEn,1.5)/lenghtScale; // calcul de epsilon pour un ecoulement etabli en conduite. A faire pour un ecoulement de grille ? (decroissance energetique)
-
-  /////////////////////////////////////////////
-  /// valeurs remarquables du nombre d'onde ///
-  /////////////////////////////////////////////
-
-  double kappa_max = (pi/dmin)*ratioCutoffWavenumber; // plus grand nombre d'onde (depend du maillage)
-  double kappa_e = 9*pi*amp/(55*lenghtScale); // pic d'energie
-  double kappa_eta = pow((turbDissRate/(visc*visc*visc)),0.25); // nombre d'onde de Kolmogorov
-  double kappa_min = kappa_e / KeOverKmin; // plus petit nombre d'onde
-  //double delta_kappa = (min(kappa_eta,kappa_max) - kappa_min) / nbModes; // repartition lineaire des modes => pas bon
-  double delta_kappa = pow( (std::min(kappa_eta,kappa_max) / kappa_min ), 1./(nbModes-1.)); // repartition logarithmique des modes => OK
-  if (kappa_max <= kappa_min)
-    {
-      Cerr << "Error: kappa_max(=" << kappa_max << ") <= kappa_min(=" << kappa_min << ")" << finl;
-      Cerr << "You should either refine your mesh or increase the ratioCutoffWavenumber value in " << que_suis_je() << finl;
-      Process::exit();
-    }
-  //Cerr << "Remarkable wavenumbers for the method of synthetic turbulence generation:" << finl;
-  //Cerr << "kappa_min = " << kappa_min << finl;
-  //Cerr << "kappa_e = " << kappa_e << finl;
-  //Cerr << "kappa_mesh = " << kappa_max << finl;
-  //Cerr << "kappa_eta = " << kappa_eta << finl;
-  //Cerr << "delta_kappa = " << delta_kappa << finl;
-
-  DoubleVect kappa_face(nbModes+1);
-  DoubleVect kappa_center(nbModes);
-  DoubleVect dkn(nbModes);
-
-  DoubleVect kappa_x(nbModes);
-  DoubleVect kappa_y(nbModes);
-  DoubleVect kappa_z(nbModes);
-
-  DoubleVect sigma_x(nbModes);
-  DoubleVect sigma_y(nbModes);
-  DoubleVect sigma_z(nbModes);
-
-  DoubleVect phi(nbModes);
-  DoubleVect alpha(nbModes);
-  DoubleVect psi(nbModes);
-  DoubleVect tetha(nbModes);
-
   ////////////////////////////////////////////
   /// generation aleatoire des angles      ///
   ////////////////////////////////////////////
 
-  for(int i = 0; i<nbModes; i++)
+  // Tirages dans le meme ordre sur tous les processeurs (meme graine) : les modes sont identiques partout
+  for(int m = 0; m<nbModes; m++)
     {
-      phi(i) = drand48()* 2*pi ;
-      alpha(i) = drand48()* 2*pi ;
-      psi(i) = drand48()* 2*pi ;
-      //tetha(i) = drand48()* pi ; // pour une densite de probabilite de 1/pi => pas bon
-      tetha(i) = acos(1-2*drand48()) ; // pour une densite de probabilite de 0.5*sin(theta) => OK
+      double phi = drand48()* 2*pi ;
+      double alpha = drand48()* 2*pi ;
+      double psi = drand48()* 2*pi ;
+      //double tetha = drand48()* pi ; // pour une densite de probabilite de 1/pi => pas bon
+      double tetha = acos(1-2*drand48()) ; // pour une densite de probabilite de 0.5*sin(theta) => OK
 
       /// creation vecteur onde en coordonnee cartesienne ///
-      kappa_x(i) = sin(tetha(i))*cos(phi(i));
-      kappa_y(i) = sin(tetha(i))*sin(phi(i));
-      kappa_z(i) = cos(tetha(i));
-
-      /// creation de la direction orthogonal au vecteur onde ///
-      sigma_x(i) = cos(phi(i))*cos(tetha(i))*cos(alpha(i)) - sin(phi(i))*sin(alpha(i));
-      sigma_y(i) = sin(phi(i))*cos(tetha(i))*cos(alpha(i)) + cos(phi(i))*sin(alpha(i));
-      sigma_z(i) = -sin(tetha(i))*cos(alpha(i));
+      modes_(m,0) = sin(tetha)*cos(phi) * kappa_center_(m);
+      modes_(m,1) = sin(tetha)*sin(phi) * kappa_center_(m);
+      modes_(m,2) = cos(tetha) * kappa_center_(m);
+      modes_(m,3) = psi;
+
+      /// creation de la direction orthogonal au vecteur onde, ponderee par l'amplitude du mode ///
+      modes_(m,4) = spectre_(m) * (cos(phi)*cos(tetha)*cos(alpha) - sin(phi)*sin(alpha));
+      modes_(m,5) = spectre_(m) * (sin(phi)*cos(tetha)*cos(alpha) + cos(phi)*sin(alpha));
+      modes_(m,6) = spectre_(m) * (-sin(tetha)*cos(alpha));
     }
 
-  //for(int i = 0; i< nbModes+1; i++) kappa_face(i) = kappa_min + delta_kappa*i; // repartition lineaire
-  for(int i = 0; i< nbModes+1; i++)
-    {
-      kappa_face(i) = kappa_min * pow(delta_kappa,i); // repartition logarithmique
-      //Cerr << "Kappa(n) = " << kappa_face(i) << finl;
-    }
-
-  for(int i = 0; i< nbModes; i++)
-    {
-      kappa_center(i) = 1.0/2.0*(kappa_face(i+1)+kappa_face(i));
-      dkn(i) = kappa_face(i+1)- kappa_face(i);
-    }
-
-  /// recuperation des centres de gravite ///
-  DoubleTab centreGrav(nb_face);
-  tabFaces.calculer_centres_gravite(centreGrav);
-
-  for( int i = 0; i<nb_face; i++ )
-    {
-      DoubleTab turb(nb_comp());
-      //recuperer les points du milieu du maillage
-
-      double x_center = centreGrav(i,0);
-      double y_center = centreGrav(i,1);
-      double z_center = centreGrav(i,2);
-
-      for(int m = 0; m<nbModes; m++)
-        {
-          double kx = kappa_x(m) * kappa_center(m);
-          double ky = kappa_y(m) * kappa_center(m);
-          double kz = kappa_z(m) * kappa_center(m);
-
-          double arg = kx*x_center + ky*y_center + kz*z_center + psi(m);
-
-          double tfunk = cos(arg);
-
-          double karman_spectrum = amp/kappa_e * (2.*turbKinEn/3.) * pow((kappa_center(m)/kappa_e),4)/pow(1+pow(kappa_center(m)/kappa_e, 2),17.0/6.0) * exp(-2*(pow(kappa_center(m)/kappa_eta, 2)));
-          double amplitude = sqrt(karman_spectrum * dkn(m));
-
-          turb(0) += 2*amplitude*tfunk*sigma_x(m);
-          turb(1) += 2*amplitude*tfunk*sigma_y(m);
-          turb(2) += 2*amplitude*tfunk*sigma_z(m);
-
-          //Cerr << "Kappa = " << kappa_center(m) << finl;
-          //Cerr << "Kappa, Spectre = " << kappa_center(m) << " , " << karman_spectrum << finl;
-          //Cerr << "Amplitude = " << amplitude << finl;
-        }
-
-      //////////////////////////////////////
-      /// MISE EN PLACE AUTOCORRELATION  ///
-      //////////////////////////////////////
-
-      double dt = equ.schema_temps().pas_de_temps();
-      double a = exp(-dt/timeScale);
-      double b = sqrt(1-a*a);
-
-      tab(i,0) = moyenne(0) + dir_fluct(0) * (a * (tab_avant(i,0) - moyenne(0)) + b * turb(0));
-      tab(i,1) = moyenne(1) + dir_fluct(1) * (a * (tab_avant(i,1) - moyenne(1)) + b * turb(1));
-      tab(i,2) = moyenne(2) + dir_fluct(2) * (a * (tab_avant(i,2) - moyenne(2)) + b * turb(2));
-
-      //Cerr << "r, a, b = " << dt/timeScale << " , " << a << " , " << b << finl;
-      //Cerr << "Uprime, uprime = " << tab(i,0) << " , " << turb(0) << finl;
-      //Cerr << "face, Uprime, uprime = " << i << " , " << tab(i,0) << " , " << turb(0) << finl;
-    }
+  //////////////////////////////////////
+  /// MISE EN PLACE AUTOCORRELATION  ///
+  //////////////////////////////////////
+
+  double dt = equ.schema_temps().pas_de_temps();
+  double a = exp(-dt/timeScale);
+  double b = sqrt(1-a*a);
+
+  const int nb_face = ref_cast(Front_VF,la_frontiere_dis.valeur()).nb_faces(), nb_modes = nbModes; // real only
+  const double m0 = moyenne(0), m1 = moyenne(1), m2 = moyenne(2);
+  const double d0 = dir_fluct(0), d1 = dir_fluct(1), d2 = dir_fluct(2);
+  CDoubleTabView centres_v = centres_faces_.view_ro();
+  CDoubleTabView modes_v = modes_.view_ro();
+  CDoubleTabView tab_avant_v = tab_avant.view_ro();
+  DoubleTabView tab_v = tab.view_rw();
+  start_gpu_timer();
+  Kokkos::parallel_for("[KOKKOS] Face loop in Champ_front_synt::mettre_a_jour", nb_face, KOKKOS_LAMBDA(const int i)
+  {
+    const double x_center = centres_v(i,0), y_center = centres_v(i,1), z_center = centres_v(i,2);
+    double turb0 = 0, turb1 = 0, turb2 = 0;
+    for(int m = 0; m<nb_modes; m++)
+      {
+        double tfunk = cos(modes_v(m,0)*x_center + modes_v(m,1)*y_center + modes_v(m,2)*z_center + modes_v(m,3));
+        turb0 += tfunk*modes_v(m,4);
+        turb1 += tfunk*modes_v(m,5);
+        turb2 += tfunk*modes_v(m,6);
+      }
+    tab_v(i,0) = m0 + d0 * (a * (tab_avant_v(i,0) - m0) + b * turb0);
+    tab_v(i,1) = m1 + d1 * (a * (tab_avant_v(i,1) - m1) + b * turb1);
+    tab_v(i,2) = m2 + d2 * (a * (tab_avant_v(i,2) - m2) + b * turb2);
+  });
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Face loop in Champ_front_synt::mettre_a_jour");
 
   tab.echange_espace_virtuel();
   temps_d_avant_ = temps;
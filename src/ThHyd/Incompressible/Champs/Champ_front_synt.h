@@ -42,6 +42,8 @@ public:
   void mettre_a_jour(double temps) override;
 
 protected :
+  void calculer_spectre(double visc);
+
   REF(Champ_Inc_base) ref_inco_;
 
   DoubleVect moyenne;
@@ -55,6 +57,14 @@ protected :
   double KeOverKmin= 0.;
   double ratioCutoffWavenumber= 0.; // au lieu de prendre kappa_mesh comme plus grand nombre d'onde, on prend kappa_mesh/ratioCutoffWavenumber (ratioCutoffWavenumber>1 permet de mieux discretiser les fluctuations => aspect plus lisse)
   double temps_d_avant_= 0.;
+
+  // Donnees calculees une fois pour toutes a l'initialisation (geometrie de la frontiere) ou quand la viscosite change (spectre)
+  DoubleTab centres_faces_; // centres de gravite des faces reelles de la frontiere
+  double dmin_ = 0.; // taille de maille caracteristique de la frontiere
+  double visc_spectre_ = -1.; // viscosite avec laquelle spectre_ a ete calcule
+  DoubleVect kappa_center_; // nombres d'onde des modes
+  DoubleVect spectre_; // 2*amplitude des modes
+  DoubleTab modes_; // par mode : kx, ky, kz, psi, 2*amplitude*sigma_x, 2*amplitude*sigma_y, 2*amplitude*sigma_z
 };
 
 #endif
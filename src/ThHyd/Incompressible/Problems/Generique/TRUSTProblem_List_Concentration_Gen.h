@@ -17,6 +17,8 @@
 #define TRUSTProblem_List_Concentration_Gen_included
 
 #include <TRUSTProblem_Concentration_Gen.h>
+#include <TRUST_Ref.h>
+#include <Chimie.h>
 
 template <typename _DERIVED_TYPE_, typename _EQUATION_TYPE_ = Convection_Diffusion_Concentration, typename _MEDIUM_TYPE_ = Constituant>
 class TRUSTProblem_List_Concentration_Gen : public TRUSTProblem_Concentration_Gen<_DERIVED_TYPE_, _EQUATION_TYPE_, _MEDIUM_TYPE_>
@@ -35,8 +37,13 @@ protected:
   void add_concentration_equations();
   Entree& lire_equations(Entree& is, Motcle& dernier_mot) override;
 
+  REF(Chimie) la_chimie_; // cinetique chimique entre les concentrations, optionnelle (Associate pb chimie)
+
 public:
   void associer_milieu_base(const Milieu_base&) override;
+  int associer_(Objet_U&) override;
+  void completer() override;
+  void mettre_a_jour(double temps) override;
   int verifier() override;
   void typer_lire_milieu(Entree& ) override;
 };
@@ -138,6 +138,40 @@ void TRUSTProblem_List_Concentration_Gen<_DERIVED_TYPE_, _EQUATION_TYPE_, _MEDIU
   else _DERIVED_TYPE_::associer_milieu_base(mil);
 }
 
+template <typename _DERIVED_TYPE_, typename _EQUATION_TYPE_, typename _MEDIUM_TYPE_>
+int TRUSTProblem_List_Concentration_Gen<_DERIVED_TYPE_, _EQUATION_TYPE_, _MEDIUM_TYPE_>::associer_(Objet_U& ob)
+{
+  if (sub_type(Chimie, ob))
+    {
+      la_chimie_ = ref_cast(Chimie, ob);
+      return 1;
+    }
+  return _DERIVED_TYPE_::associer_(ob);
+}
+
+/*! @brief Les especes de la chimie sont les inconnues des equations de la liste (concentration0, concentration1, ...).
+ */
+template <typename _DERIVED_TYPE_, typename _EQUATION_TYPE_, typename _MEDIUM_TYPE_>
+void TRUSTProblem_List_Concentration_Gen<_DERIVED_TYPE_, _EQUATION_TYPE_, _MEDIUM_TYPE_>::completer()
+{
+  _DERIVED_TYPE_::completer();
+  if (la_chimie_.non_nul())
+    {
+      la_chimie_->discretiser(*this);
+      la_chimie_->completer(*this);
+    }
+}
+
+/*! @brief La chimie est integree sur le pas de temps apres le transport (decomposition d'operateurs).
+ */
+template <typename _DERIVED_TYPE_, typename _EQUATION_TYPE_, typename _MEDIUM_TYPE_>
+void TRUSTProblem_List_Concentration_Gen<_DERIVED_TYPE_, _EQUATION_TYPE_, _MEDIUM_TYPE_>::mettre_a_jour(double temps)
+{
+  _DERIVED_TYPE_::mettre_a_jour(temps);
+  if (la_chimie_.non_nul())
+    la_chimie_->mettre_a_jour(temps);
+}
+
 template <typename _DERIVED_TYPE_, typename _EQUATION_TYPE_, typename _MEDIUM_TYPE_>
 int TRUSTProblem_List_Concentration_Gen<_DERIVED_TYPE_, _EQUATION_TYPE_, _MEDIUM_TYPE_>::verifier()
 {
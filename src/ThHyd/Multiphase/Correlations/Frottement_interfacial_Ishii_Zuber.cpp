@@ -78,6 +78,36 @@ void Frottement_interfacial_Ishii_Zuber::coefficient(const DoubleTab& alpha, con
       }
 }
 
+/* boucle interne sur les items, sur des pointeurs bruts : vectorisable */
+void Frottement_interfacial_Ishii_Zuber::coefficient_lot(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
+                                                         const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, const DoubleVect& Dh,
+                                                         const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const
+{
+  const int nb = coeff.dimension_tot(0), N = ndv.dimension(1), Ns = sigma.dimension(1), sR = (rho.dimension_tot(0) == 1) ? 0 : N, sM = (mu.dimension_tot(0) == 1) ? 0 : N;
+  const double *al = alpha.addr(), *rh = rho.addr(), *vi = mu.addr(), *sg = sigma.addr(), *nv = ndv.addr(), *db = d_bulles.addr();
+  double *c = coeff.addr(); // c[2 * (N * (N * i + k) + l) + j] = coeff(i, k, l, j)
+
+  coeff = 0;
+
+  for (int k = 0; k < N; k++)
+    if (k!=n_l)
+      {
+        const int ind_trav = (k>n_l) ? (n_l*(N-1)-(n_l-1)*(n_l)/2) + (k-n_l-1) : (k*(N-1)-(k-1)*(k)/2) + (n_l-k-1);
+        for (int i = 0; i < nb; i++)
+          {
+            const double r_l = rh[sR * i + n_l], d_k = db[N * i + k], a_l = al[N * i + n_l], v = nv[N * (N * i + n_l) + k];
+            double Re = r_l * std::max(v, 1.e-6)  * d_k/vi[sM * i + n_l];
+            double Eo = g_ * std::abs(r_l-rh[sR * i + k]) * d_k*d_k/sg[Ns * i + ind_trav];
+            double Cd = beta_ * std::max( 24./Re*(1.+.1*std::pow(Re, .75))  , 2.3*std::sqrt(Eo));
+            double c1 = 3./4.*Cd/d_k * al[N * i + k] * r_l;
+            if (a_l < 1.e-6) c1 = c1 * a_l * 1.e6;
+
+            c[2 * (N * (N * i + k) + n_l) + 1] = c[2 * (N * (N * i + n_l) + k) + 1] = c1;
+            c[2 * (N * (N * i + k) + n_l)] = c[2 * (N * (N * i + n_l) + k)] = c1 * v;
+          }
+      }
+}
+
 
 void Frottement_interfacial_Ishii_Zuber::coefficient_CD(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
                                                         const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, double Dh,
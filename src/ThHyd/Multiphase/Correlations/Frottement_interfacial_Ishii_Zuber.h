@@ -30,6 +30,9 @@ public:
   void coefficient(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
                    const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, double Dh,
                    const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const override;
+  void coefficient_lot(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
+                       const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, const DoubleVect& Dh,
+                       const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const override;
   void coefficient_CD(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
                       const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, double Dh,
                       const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const  override;
@@ -14,6 +14,7 @@
 *****************************************************************************/
 
 #include <Frottement_interfacial_base.h>
+#include <TRUSTTrav.h>
 Implemente_base(Frottement_interfacial_base, "Frottement_interfacial_base", Correlation_base);
 // XD frottement_interfacial source_base frottement_interfacial 1 Source term which corresponds to the phases friction at the interface
 // XD attr a_res floattant a_res 1 void fraction at which the  gas velocity is forced to approach liquid velocity (default alpha_evanescence*100)
@@ -29,3 +30,24 @@ Entree& Frottement_interfacial_base::readOn(Entree& is)
 {
   return is;
 }
+
+void Frottement_interfacial_base::coefficient_lot(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
+                                                  const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, const DoubleVect& Dh,
+                                                  const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const
+{
+  const int nb = coeff.dimension_tot(0), N = ndv.dimension(1), Ns = sigma.dimension(1), cR = (rho.dimension_tot(0) == 1), cM = (mu.dimension_tot(0) == 1);
+  DoubleTrav a_l(N), p_l(N), T_l(N), rho_l(N), mu_l(N), sigma_l(Ns), dv(N, N), d_bulles_l(N), coeff_l(N, N, 2);
+  for (int i = 0; i < nb; i++)
+    {
+      for (int n = 0; n < N; n++)
+        {
+          a_l(n) = alpha(i, n), p_l(n) = p(i, n), T_l(n) = T(i, n), rho_l(n) = rho(!cR * i, n), mu_l(n) = mu(!cM * i, n), d_bulles_l(n) = d_bulles(i, n);
+          for (int k = 0; k < N; k++) dv(n, k) = ndv(i, n, k);
+        }
+      for (int n = 0; n < Ns; n++) sigma_l(n) = sigma(i, n);
+      coefficient(a_l, p_l, T_l, rho_l, mu_l, sigma_l, Dh(i), dv, d_bulles_l, coeff_l);
+      for (int k = 0; k < N; k++)
+        for (int l = 0; l < N; l++)
+          for (int j = 0; j < 2; j++) coeff(i, k, l, j) = coeff_l(k, l, j);
+    }
+}
@@ -44,6 +44,13 @@ public:
   virtual void coefficient_CD(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
                               const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, double Dh,
                               const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const  {Process::exit(que_suis_je() + " : you must calculate CD in your interfacial drag correlation !");};
+
+  /* version par lots : une ligne par item (element...) pour chaque argument de coefficient() -> alpha(i, n), p(i, n), T(i, n), rho(i, n), mu(i, n),
+     sigma(i, ind_trav), Dh(i), ndv(i, k, l), d_bulles(i, n) ; rho et mu peuvent n'avoir qu'une ligne (milieu uniforme)
+     sortie : coeff(i, k, l, 0/1). Par defaut, appel de coefficient() item par item */
+  virtual void coefficient_lot(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
+                               const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, const DoubleVect& Dh,
+                               const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const;
 };
 
 #endif
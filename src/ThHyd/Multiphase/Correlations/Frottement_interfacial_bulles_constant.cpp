@@ -62,3 +62,24 @@ void Frottement_interfacial_bulles_constant::coefficient(const DoubleTab& alpha,
         coeff(n_l, k, 0) = coeff(n_l, k, 1) * ndv(n_l,k);
       }
 }
+
+/* boucle interne sur les items, sur des pointeurs bruts : vectorisable */
+void Frottement_interfacial_bulles_constant::coefficient_lot(const DoubleTab& alpha, const DoubleTab& p, const DoubleTab& T,
+                                                             const DoubleTab& rho, const DoubleTab& mu, const DoubleTab& sigma, const DoubleVect& Dh,
+                                                             const DoubleTab& ndv, const DoubleTab& d_bulles, DoubleTab& coeff) const
+{
+  const int nb = coeff.dimension_tot(0), N = ndv.dimension(1), sR = (rho.dimension_tot(0) == 1) ? 0 : N;
+  const double *al = alpha.addr(), *rh = rho.addr(), *nv = ndv.addr(), *db = d_bulles.addr();
+  double *c = coeff.addr(); // c[2 * (N * (N * i + k) + l) + j] = coeff(i, k, l, j)
+
+  coeff = 0.;
+
+  for (int k = 0; k < N; k++)
+    if (k!=n_l)
+      for (int i = 0; i < nb; i++)
+        {
+          const double c1 = (r_bulle_ > 0) ? 3. / 8. * C_d_ * al[N * i + k] / r_bulle_ * rh[sR * i + n_l] : 3. / 4. * C_d_ * al[N * i + k] / db[N * i + k] * rh[sR * i + n_l];
+          c[2 * (N * (N * i + k) + n_l) + 1] = c[2 * (N * (N * i + n_l) + k) + 1] = c1;
+          c[2 * (N * (N * i + k) + n_l)] = c[2 * (N * (N * i + n_l) + k)] = c1 * nv[N * (N * i + n_l) + k];
+        }
+}
@@ -56,6 +56,22 @@ void Masse_ajoutee_Coef_Constant::ajouter(const double *alpha, const double *rho
       }
 }
 
+/* boucle interne sur les elements, sur des pointeurs bruts : vectorisable */
+void Masse_ajoutee_Coef_Constant::ajouter_lot(const DoubleTab& alpha, const DoubleTab& rho, DoubleTab& a_r) const
+{
+  const int nb = a_r.dimension_tot(0), N = a_r.dimension(1), Na = alpha.line_size(), sR = (rho.dimension_tot(0) == 1) ? 0 : rho.line_size();
+  const double *al = alpha.addr(), *rh = rho.addr();
+  double *ar = a_r.addr();
+  for (int k = 0; k < N; k++)
+    if (n_l != k)
+      for (int e = 0; e < nb; e++)
+        {
+          const double r_l = rh[sR * e + n_l], m = std::min(beta * r_l * al[Na * e + k], limiter_liquid_ * r_l * al[Na * e + n_l]);
+          double *ar_e = ar + N * N * e;
+          ar_e[N * k + k] += m, ar_e[N * k + n_l] -= m, ar_e[N * n_l + n_l] += m, ar_e[N * n_l + k] -= m;
+        }
+}
+
 void Masse_ajoutee_Coef_Constant::coefficient(  const double *alpha, const double *rho, DoubleTab& coeff) const
 {
   int k, N = coeff.dimension(0);
@@ -32,6 +32,7 @@ class Masse_ajoutee_Coef_Constant : public Masse_ajoutee_base
 
 public:
   void ajouter(const double *alpha, const double *rho, DoubleTab& a_r  ) const override;
+  void ajouter_lot(const DoubleTab& alpha, const DoubleTab& rho, DoubleTab& a_r) const override;
   void coefficient(const double *alpha, const double *rho, DoubleTab& coeff) const override;
   void ajouter_inj(const double *flux_alpha, const double *alpha, const double *rho, DoubleTab& f_a_r) const override;
 
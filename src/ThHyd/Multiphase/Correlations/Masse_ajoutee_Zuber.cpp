@@ -57,6 +57,23 @@ void Masse_ajoutee_Zuber::ajouter(const double *alpha, const double *rho, Double
       }
 }
 
+/* boucle interne sur les elements, sur des pointeurs bruts : vectorisable */
+void Masse_ajoutee_Zuber::ajouter_lot(const DoubleTab& alpha, const DoubleTab& rho, DoubleTab& a_r) const
+{
+  const int nb = a_r.dimension_tot(0), N = a_r.dimension(1), Na = alpha.line_size(), sR = (rho.dimension_tot(0) == 1) ? 0 : rho.line_size();
+  const double *al = alpha.addr(), *rh = rho.addr();
+  double *ar = a_r.addr();
+  for (int k = 0; k < N; k++)
+    if (n_l != k)
+      for (int e = 0; e < nb; e++)
+        {
+          const double a_k = al[Na * e + k], r_l = rh[sR * e + n_l], coeff_loc = beta * ( 1 + 2*a_k) / std::max(1 - a_k, 1.e-3),
+                       m = std::min(coeff_loc * r_l * a_k, limiter_liquid_ * r_l * al[Na * e + n_l]);
+          double *ar_e = ar + N * N * e;
+          ar_e[N * k + k] += m, ar_e[N * k + n_l] -= m, ar_e[N * n_l + n_l] += m, ar_e[N * n_l + k] -= m;
+        }
+}
+
 void Masse_ajoutee_Zuber::ajouter_inj(const double *flux_alpha, const double *alpha,  const double *rho, DoubleTab& f_a_r) const
 {
   int N = f_a_r.dimension(0);
@@ -31,6 +31,7 @@ class Masse_ajoutee_Zuber : public Masse_ajoutee_base
 
 public:
   void ajouter(const double *alpha, const double *rho, DoubleTab& a_r) const override;
+  void ajouter_lot(const DoubleTab& alpha, const DoubleTab& rho, DoubleTab& a_r) const override;
   void ajouter_inj(const double *flux_alpha, const double *alpha, const double *rho, DoubleTab& f_a_r) const override;
 
 protected:
@@ -14,6 +14,7 @@
 *****************************************************************************/
 
 #include <Masse_ajoutee_base.h>
+#include <TRUSTTrav.h>
 Implemente_base(Masse_ajoutee_base, "Masse_ajoutee_base", Correlation_base);
 
 Sortie& Masse_ajoutee_base::printOn(Sortie& os) const
@@ -25,3 +26,17 @@ Entree& Masse_ajoutee_base::readOn(Entree& is)
 {
   return is;
 }
+
+void Masse_ajoutee_base::ajouter_lot(const DoubleTab& alpha, const DoubleTab& rho, DoubleTab& a_r) const
+{
+  const int nb = a_r.dimension_tot(0), N = a_r.dimension(1), cR = (rho.dimension_tot(0) == 1);
+  DoubleTrav a_r_e(N, N);
+  for (int e = 0; e < nb; e++)
+    {
+      for (int k = 0; k < N; k++)
+        for (int l = 0; l < N; l++) a_r_e(k, l) = a_r(e, k, l);
+      ajouter(&alpha(e, 0), &rho(!cR * e, 0), a_r_e);
+      for (int k = 0; k < N; k++)
+        for (int l = 0; l < N; l++) a_r(e, k, l) = a_r_e(k, l);
+    }
+}
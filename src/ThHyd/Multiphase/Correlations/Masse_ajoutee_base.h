@@ -41,6 +41,10 @@ public:
   virtual void coefficient(const double *alpha, const double *rho, DoubleTab& coeff) const {Process::exit(que_suis_je() + " : you must define a coefficient function for added mass !");};
   virtual void ajouter_inj(const double *flux_alpha, const double *alpha, const double *rho, DoubleTab& f_a_r) const = 0;
 
+  /* version par lots : alpha(e, n), rho(e, n) (ou une seule ligne si milieu uniforme) -> a_r(e, k, l) pour tous les e de a_r
+     par defaut, appel de ajouter() element par element */
+  virtual void ajouter_lot(const DoubleTab& alpha, const DoubleTab& rho, DoubleTab& a_r) const;
+
 protected:
   double limiter_liquid_ = 0.5 ; // Maximum percentage of the liquid that can be entrained by the bubbles
 };
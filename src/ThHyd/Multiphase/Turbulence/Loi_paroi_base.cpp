@@ -61,6 +61,12 @@ void Loi_paroi_base::completer()
       }
   Faces_a_calculer_.echange_espace_virtuel();
 
+  int nb_faces_paroi = 0;
+  for (int f = 0 ; f < nf_tot ; f ++) nb_faces_paroi += (Faces_a_calculer_(f,0)==1);
+  faces_paroi_.resize_array(nb_faces_paroi);
+  for (int f = 0, k = 0 ; f < nf_tot ; f ++)
+    if (Faces_a_calculer_(f,0)==1) faces_paroi_[k++] = f;
+
   valeurs_loi_paroi_["y_plus"] = DoubleTab(nf_tot,1); // pour l'instant, turbulence dans seulement une phase
   valeurs_loi_paroi_["u_tau"] = DoubleTab(nf_tot,1);
 
@@ -83,16 +89,15 @@ void Loi_paroi_base::mettre_a_jour(double temps)
         {
           Domaine_VF& domaine = ref_cast(Domaine_VF, pb_.valeur().domaine_dis().valeur());
           const IntTab& f_e = domaine.face_voisins();
-          int nf_tot = domaine.nb_faces_tot();
           DoubleTab& y_p = valeurs_loi_paroi_["y_plus"], &y_p_e = valeurs_loi_paroi_["y_plus_elem"];
-          for (int f = 0 ; f < nf_tot ; f ++)
-            if (Faces_a_calculer_(f,0)==1)
-              {
-                int c = (f_e(f,0)>=0) ? 0 : 1 ;
-                if (f_e(f, (c==0) ? 1 : 0 ) >= 0) Process::exit("Error in the definition of the boundary conditions for wall laws");
-                int e = f_e(f,c);
-                y_p_e(e,0) = y_p(f,0);
-              }
+          for (int k = 0 ; k < faces_paroi_.size_array() ; k ++)
+            {
+              const int f = faces_paroi_[k];
+              int c = (f_e(f,0)>=0) ? 0 : 1 ;
+              if (f_e(f, (c==0) ? 1 : 0 ) >= 0) Process::exit("Error in the definition of the boundary conditions for wall laws");
+              int e = f_e(f,c);
+              y_p_e(e,0) = y_p(f,0);
+            }
           ref_cast(QDM_Multiphase, pb_->equation(0)).update_y_plus(y_p_e);
         }
       tps_loc = temps;
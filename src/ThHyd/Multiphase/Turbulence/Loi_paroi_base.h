@@ -47,6 +47,7 @@ protected:
   double y_p_min_ = 1.e-2; // minimal y_p
 
   IntTab Faces_a_calculer_;
+  ArrOfInt faces_paroi_; // liste des faces (reelles et virtuelles) ou Faces_a_calculer_ vaut 1
   std::map<std::string, DoubleTab> valeurs_loi_paroi_; // contient "y_plus", "u_tau" pour toutes les faces
   double tps_loc = -1.e8;
 };
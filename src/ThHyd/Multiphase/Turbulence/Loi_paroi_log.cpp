@@ -27,6 +27,7 @@
 #include <math.h>
 #include <Nom.h>
 #include <Champ_Face_base.h>
+#include <typeinfo>
 
 Implemente_instanciable(Loi_paroi_log, "Loi_paroi_log", Loi_paroi_base);
 
@@ -59,68 +60,128 @@ void Loi_paroi_log::calc_y_plus(const DoubleTab& vit, const DoubleTab& nu_visc)
     }
 
   int n=0; // pour l'instant, turbulence dans seulement une phase
+  const int nb_faces_paroi = faces_paroi_.size_array();
 
-  for (int f = 0 ; f < nf_tot ; f ++)
-    if (Faces_a_calculer_(f,0)==1)
-      {
-        int c = (f_e(f,0)>=0) ? 0 : 1 ;
-        if (f_e(f, (c==0) ? 1 : 0 ) >= 0) Process::exit("Error in the definition of the boundary conditions for wall laws");
-        int e = f_e(f,c);
-
-        double u_orth = 0 ;
-        DoubleTrav u_parallel(D);
-        if (nf_tot == vit.dimension_tot(0)) // VDF case
-          {
-            for (int d = 0; d <D ; d++) u_orth -= pvit_elem(e, N*d+n)*n_f(f,d)/fs(f); // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
-            for (int d = 0 ; d < D ; d++) u_parallel(d) = pvit_elem(e, N*d+n) - u_orth*(-n_f(f,d))/fs(f) ; // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
-          }
-        else // PolyMAC case
-          {
-            for (int d = 0; d <D ; d++) u_orth -= vit(nf_tot + e * D+d, n)*n_f(f,d)/fs(f); // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
-            for (int d = 0 ; d < D ; d++) u_parallel(d) = vit(nf_tot + e * D + d, n) - u_orth*(-n_f(f,d))/fs(f) ; // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
-          }
-
-        double residu = 0 ;
-        for (int d = 0; d <D ; d++) residu += u_parallel(d)*n_f(f,d)/fs(f);
-        if (residu > 1e-8) Process::exit("Loi_paroi_adaptative : Error in the calculation of the parallel velocity for wall laws");
-        double norm_u_parallel = std::sqrt(domaine.dot(&u_parallel(0), &u_parallel(0)));
-
-        double y_loc = (c==0) ? domaine.dist_face_elem0(f,e) : domaine.dist_face_elem1(f,e) ;
-        y_p(f, n) = std::max(y_p_min_, calc_y_plus_loc(norm_u_parallel, nu_visc(e, n), y_loc, y_p(f, n)));
-        u_t(f, n) = y_p(f, n)*nu_visc(e, n)/y_loc;
-      }
+  // 1. vitesse parallele, distance a la paroi et viscosite sur chaque face de paroi
+  ArrOfDouble u_par(nb_faces_paroi), nu_loc(nb_faces_paroi), y_loc(nb_faces_paroi), y_p_lot(nb_faces_paroi);
+  double u_parallel[3];
+  for (int k = 0 ; k < nb_faces_paroi ; k ++)
+    {
+      const int f = faces_paroi_[k];
+      int c = (f_e(f,0)>=0) ? 0 : 1 ;
+      if (f_e(f, (c==0) ? 1 : 0 ) >= 0) Process::exit("Error in the definition of the boundary conditions for wall laws");
+      int e = f_e(f,c);
+
+      double u_orth = 0 ;
+      if (nf_tot == vit.dimension_tot(0)) // VDF case
+        {
+          for (int d = 0; d <D ; d++) u_orth -= pvit_elem(e, N*d+n)*n_f(f,d)/fs(f); // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
+          for (int d = 0 ; d < D ; d++) u_parallel[d] = pvit_elem(e, N*d+n) - u_orth*(-n_f(f,d))/fs(f) ; // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
+        }
+      else // PolyMAC case
+        {
+          for (int d = 0; d <D ; d++) u_orth -= vit(nf_tot + e * D+d, n)*n_f(f,d)/fs(f); // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
+          for (int d = 0 ; d < D ; d++) u_parallel[d] = vit(nf_tot + e * D + d, n) - u_orth*(-n_f(f,d))/fs(f) ; // ! n_f pointe vers la face 1 donc vers l'exterieur de l'element, d'ou le -
+        }
+
+      double residu = 0 ;
+      for (int d = 0; d <D ; d++) residu += u_parallel[d]*n_f(f,d)/fs(f);
+      if (residu > 1e-8) Process::exit("Loi_paroi_adaptative : Error in the calculation of the parallel velocity for wall laws");
+      u_par[k] = std::sqrt(domaine.dot(u_parallel, u_parallel));
+      y_loc[k] = (c==0) ? domaine.dist_face_elem0(f,e) : domaine.dist_face_elem1(f,e) ;
+      nu_loc[k] = nu_visc(e, n);
+      y_p_lot[k] = y_p(f, n); // y_plus du pas de temps precedent comme point de depart
+    }
+
+  // 2. resolution de la loi de paroi sur toutes les faces a la fois
+  calc_y_plus_lot(u_par, nu_loc, y_loc, y_p_lot);
+
+  for (int k = 0 ; k < nb_faces_paroi ; k ++)
+    {
+      const int f = faces_paroi_[k];
+      y_p(f, n) = std::max(y_p_min_, y_p_lot[k]);
+      u_t(f, n) = y_p(f, n)*nu_loc[k]/y_loc[k];
+    }
 }
 
-double Loi_paroi_log::calc_y_plus_loc(double u_par, double nu, double y, double y_p_0)
+/*! @brief Resolution par Newton de u+(y_plus) = u_par / u_tau pour un lot de faces. y_p contient en entree le point de depart
+ *
+ *   (y_plus precedent) et en sortie la solution. Pour Loi_paroi_log elle-meme, u+ est evalue en ligne (u_plus_log) ; une classe
+ *   derivee qui redefinit u_plus_de_y_plus / deriv_u_plus_de_y_plus est resolue avec ses methodes virtuelles.
+ *
+ */
+void Loi_paroi_log::calc_y_plus_lot(const ArrOfDouble& u_par, const ArrOfDouble& nu, const ArrOfDouble& y, ArrOfDouble& y_p)
 {
-  if (u_par*y/nu < limiteur_y_p) return limiteur_y_p;
-
-  double eps = eps_y_p_;
-  int step = 1, iter_max = 30;
+  if (typeid(*this) == typeid(Loi_paroi_log))
+    newton_y_plus_lot(u_par, nu, y, y_p, [this](double yp) { return u_plus_log(yp); }, [this](double yp) { return deriv_u_plus_log(yp); });
+  else
+    newton_y_plus_lot(u_par, nu, y, y_p, [this](double yp) { return u_plus_de_y_plus(yp); }, [this](double yp) { return deriv_u_plus_de_y_plus(yp); });
+}
 
-  double y_p = y_p_0 ;
-  double u_tau = nu*y_p/y;
+/*! @brief Iterations de Newton appliquees a toutes les faces non encore convergees (liste compactee apres chaque iteration) :
+ *
+ *   avec les fonctions en ligne de Loi_paroi_log, les boucles sont sans appel virtuel et le compilateur peut les vectoriser.
+ *
+ */
+template <typename U_PLUS, typename DERIV_U_PLUS>
+void Loi_paroi_log::newton_y_plus_lot(const ArrOfDouble& u_par, const ArrOfDouble& nu, const ArrOfDouble& y, ArrOfDouble& y_p, U_PLUS u_plus, DERIV_U_PLUS deriv_u_plus) const
+{
+  const int nb = y_p.size_array(), iter_max = 30;
+  const double eps = eps_y_p_;
+  ArrOfInt actives(nb);
+  ArrOfDouble y_p_act(nb), u_par_act(nb), nu_y_act(nb);
+  int nb_act = 0;
+  for (int k = 0; k < nb; k++)
+    if (u_par[k]*y[k]/nu[k] < limiteur_y_p)
+      y_p[k] = limiteur_y_p;
+    else
+      {
+        actives[nb_act] = k;
+        y_p_act[nb_act] = y_p[k];
+        u_par_act[nb_act] = u_par[k];
+        nu_y_act[nb_act] = nu[k]/y[k];
+        nb_act++;
+      }
 
-  do
+  double *yp = y_p_act.addr(), *up = u_par_act.addr(), *nuy = nu_y_act.addr();
+  for (int step = 2; nb_act > 0; step++)
     {
-      y_p = std::max(limiteur_y_p, y_p - (u_plus_de_y_plus(y_p) - u_par/u_tau)/(deriv_u_plus_de_y_plus(y_p) + u_par/(u_tau*y_p) ));
-      step = step+1;
-      u_tau = nu*y_p/y;
+      // iteration de Newton sur toutes les faces actives
+      for (int i = 0; i < nb_act; i++)
+        {
+          const double u_tau = nuy[i]*yp[i];
+          yp[i] = std::max(limiteur_y_p, yp[i] - (u_plus(yp[i]) - up[i]/u_tau)/(deriv_u_plus(yp[i]) + up[i]/(u_tau*yp[i])));
+        }
+      // on retire les faces convergees (ou ayant atteint iter_max)
+      int nb_restantes = 0;
+      for (int i = 0; i < nb_act; i++)
+        {
+          const double residu = std::fabs(u_plus(yp[i]) - up[i]/(nuy[i]*yp[i]));
+          if (residu > eps && step < iter_max)
+            {
+              actives[nb_restantes] = actives[i];
+              yp[nb_restantes] = yp[i];
+              up[nb_restantes] = up[i];
+              nuy[nb_restantes] = nuy[i];
+              nb_restantes++;
+            }
+          else
+            {
+              assert(residu < eps*10 && step < iter_max);
+              y_p[actives[i]] = yp[i];
+            }
+        }
+      nb_act = nb_restantes;
     }
-  while( (std::fabs(u_plus_de_y_plus(y_p) - u_par/u_tau) > eps) and (step < iter_max));
-
-  assert ( (std::fabs(u_par/u_tau - u_plus_de_y_plus(y_p)) < eps_y_p_*10) and (step < iter_max));
-
-  return y_p;
 }
 
 double Loi_paroi_log::u_plus_de_y_plus(double y_p)  // Blended Reichardt model
 {
-  return std::log(y_p+limiteur_y_p)/von_karman_ + 5.1;
+  return u_plus_log(y_p);
 }
 
 double Loi_paroi_log::deriv_u_plus_de_y_plus(double y_p)
 {
-  return 1./((y_p+limiteur_y_p)*von_karman_);
+  return deriv_u_plus_log(y_p);
 }
 
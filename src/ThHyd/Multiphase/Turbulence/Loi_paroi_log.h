@@ -22,6 +22,7 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <cmath>
 
 /*! @brief classe Loi_paroi_adaptative correlation pour une loi de paroi adaptative qui calcule u_tau et du y_plus
  *
@@ -34,11 +35,15 @@ class Loi_paroi_log : public Loi_paroi_base
   Declare_instanciable(Loi_paroi_log);
 public:
   void   calc_y_plus(const DoubleTab& vit, const DoubleTab& nu_visc) override;
-  virtual double u_plus_de_y_plus(double y_p) ; // Blended Reichardt model
-  virtual double deriv_u_plus_de_y_plus(double y_p) ;
+  virtual double u_plus_de_y_plus(double y_p); // Blended Reichardt model
+  virtual double deriv_u_plus_de_y_plus(double y_p);
+  virtual void calc_y_plus_lot(const ArrOfDouble& u_par, const ArrOfDouble& nu, const ArrOfDouble& y, ArrOfDouble& y_p);
 
 protected:
-  double calc_y_plus_loc( double y_p, double nu, double y, double y_p_0) ;
+  template <typename U_PLUS, typename DERIV_U_PLUS>
+  void newton_y_plus_lot(const ArrOfDouble& u_par, const ArrOfDouble& nu, const ArrOfDouble& y, ArrOfDouble& y_p, U_PLUS u_plus, DERIV_U_PLUS deriv_u_plus) const;
+  inline double u_plus_log(double y_p) const { return std::log(y_p+limiteur_y_p)/von_karman_ + 5.1; }
+  inline double deriv_u_plus_log(double y_p) const { return 1./((y_p+limiteur_y_p)*von_karman_); }
 
   double von_karman_ = 0.41;
   double limiteur_y_p = 0.01; // To prevent numerical issues ; no consequence on the calculation, as it falls in the region where the blending function is zero
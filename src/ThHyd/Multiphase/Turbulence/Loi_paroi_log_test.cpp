@@ -0,0 +1,104 @@
+/****************************************************************************
+* Copyright (c) 2024, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#include <cppunit.h>
+#ifdef cppunit_
+#include <Loi_paroi_log.h>
+#include <cmath>
+
+// Loi log decalee : sert a verifier que calc_y_plus_lot respecte une redefinition de u_plus_de_y_plus
+class Loi_paroi_log_decalee : public Loi_paroi_log
+{
+public:
+  double u_plus_de_y_plus(double y_p) override { return Loi_paroi_log::u_plus_de_y_plus(y_p) + 1.; }
+};
+
+class Loi_paroi_log_Test: public CPPUNIT_NS::TestFixture
+{
+  CPPUNIT_TEST_SUITE( Loi_paroi_log_Test );
+  CPPUNIT_TEST( test_lot_loi_log );
+  CPPUNIT_TEST( test_lot_loi_derivee );
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  ArrOfDouble u_par_, nu_, y_;
+
+  void setUp() override
+  {
+    // faces couvrant la sous-couche visqueuse (u_par*y/nu petit) jusqu'a la zone log (y+ ~ 1e3)
+    const int nb = 200;
+    u_par_.resize_array(nb), nu_.resize_array(nb), y_.resize_array(nb);
+    for (int k = 0; k < nb; k++)
+      {
+        u_par_[k] = 1.e-3 * std::pow(1.e4, k / (nb - 1.));
+        nu_[k] = (k % 2) ? 1.e-6 : 1.5e-5;
+        y_[k] = 1.e-4 * (1 + k % 7);
+      }
+  }
+
+  // y_plus solution de u+(y_plus) = u_par/u_tau, u_tau = y_plus*nu/y, par Newton face par face sur les methodes virtuelles
+  double y_plus_reference(Loi_paroi_log& loi, double u_par, double nu, double y)
+  {
+    double y_p = 1.;
+    for (int it = 0; it < 100; it++)
+      {
+        const double u_tau = y_p * nu / y;
+        y_p = std::max(0.01, y_p - (loi.u_plus_de_y_plus(y_p) - u_par / u_tau) / (loi.deriv_u_plus_de_y_plus(y_p) + u_par / (u_tau * y_p)));
+      }
+    return y_p;
+  }
+
+  void verifier_lot(Loi_paroi_log& loi)
+  {
+    const int nb = u_par_.size_array();
+    ArrOfDouble y_p(nb);
+    y_p = 1.; // point de depart
+    loi.calc_y_plus_lot(u_par_, nu_, y_, y_p);
+    for (int k = 0; k < nb; k++)
+      if (u_par_[k] * y_[k] / nu_[k] >= 0.01)
+        {
+          const double y_p_ref = y_plus_reference(loi, u_par_[k], nu_[k], y_[k]);
+          CPPUNIT_ASSERT_MESSAGE("calc_y_plus_lot: y_plus differs from the face by face solution", std::fabs(y_p[k] - y_p_ref) <= 1.e-3 * y_p_ref);
+          const double residu = std::fabs(loi.u_plus_de_y_plus(y_p[k]) - u_par_[k] * y_[k] / (nu_[k] * y_p[k]));
+          CPPUNIT_ASSERT_MESSAGE("calc_y_plus_lot: wall law not satisfied", residu < 1.e-3);
+        }
+      else
+        CPPUNIT_ASSERT_MESSAGE("calc_y_plus_lot: y_plus not limited in the viscous sublayer", std::fabs(y_p[k] - 0.01) < 1.e-12);
+  }
+
+  // chemin par lot avec u+ en ligne : type dynamique exactement Loi_paroi_log
+  void test_lot_loi_log()
+  {
+    Loi_paroi_log loi;
+    verifier_lot(loi);
+  }
+
+  // une classe derivee doit etre resolue avec sa propre loi u+(y+)
+  void test_lot_loi_derivee()
+  {
+    Loi_paroi_log_decalee loi;
+    verifier_lot(loi);
+    Loi_paroi_log loi_log;
+    ArrOfDouble y_p(1), y_p_log(1), u_par(1), nu(1), y(1);
+    u_par = 1., nu = 1.e-6, y = 1.e-3, y_p = 1., y_p_log = 1.;
+    loi.calc_y_plus_lot(u_par, nu, y, y_p);
+    loi_log.calc_y_plus_lot(u_par, nu, y, y_p_log);
+    CPPUNIT_ASSERT_MESSAGE("calc_y_plus_lot ignores the u_plus_de_y_plus override", y_p[0] < y_p_log[0]);
+  }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Loi_paroi_log_Test );
+
+#endif
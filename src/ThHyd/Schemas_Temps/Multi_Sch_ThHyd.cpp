@@ -191,6 +191,7 @@ int Multi_Sch_ThHyd::faire_un_pas_de_temps_eqn_base(Equation_base& eqn)
     {
       sch_ns->set_dt()=pas_de_temps();
       sch_ns.faire_un_pas_de_temps_eqn_base(eqn);
+      sch_ns->reduire_criteres_statio();
       facteur_securite_pas()=sch_ns.facteur_securite_pas();
     }
   else
@@ -198,6 +199,7 @@ int Multi_Sch_ThHyd::faire_un_pas_de_temps_eqn_base(Equation_base& eqn)
       //sch_scalaires.preparer_pas_temps();
       sch_scalaires->set_dt()=pas_de_temps();
       sch_scalaires.faire_un_pas_de_temps_eqn_base(eqn);
+      sch_scalaires->reduire_criteres_statio();
     }
   set_stationnaire_atteint()=sch_ns.valeur().isStationary() && sch_scalaires.valeur().isStationary() ;
   return 1;
@@ -68,6 +68,12 @@ private:
   template<typename Type_Double> void fill_coeffs_matrices(const int, Type_Double&, Type_Double&, Matrice_Morse*, VectorDeriv&) const;
   template<typename Type_Double> void fill_coeffs_matrices(const int, const double, Type_Double&, Type_Double&, Matrice_Morse*, VectorDeriv&) const;
 
+  // Assemblage en deux phases de la matrice de l'inconnue : places_mat_(f, 2 * i + j, n) est la place dans les coefficients de
+  // mat_places_ de M(N * elem(f, i) + n, N * elem(f, j) + n), enregistree au premier assemblage (phase symbolique) puis reutilisee
+  inline double& coeff_mat(Matrice_Morse& mat, const int f, const int i, const int j, const int n, const int N) const;
+  mutable IntTab places_mat_;
+  mutable const Matrice_Morse* mat_places_ = nullptr;
+
   // method implementee dans FT (trio) pour TCL model. Dans TRUST, la methode return false ...
   template <typename Type_Double> bool ajouter_blocs_bords_echange_ext_FT_TCL(const Echange_externe_impose& , const int , const int , const int , const int , const Front_VF& , matrices_t mats, DoubleTab& resu, const tabs_t& semi_impl) const;
 
@@ -364,9 +364,9 @@ inline void Iterateur_VDF_Elem<_TYPE_>::fill_coeffs_matrices(const int f, const
   if (mat)
     {
       for (int i = 0; i < 2; i++)
-        for (int j = 0, e = elem(f, i); j < 2; j++)
-          for (int n = 0, eb = elem(f, j); n < N; n++)
-            (*mat)(N * e + n, N * eb + n) += (i == j ? 1.0 : -1.0) * coeff * (j ? ajj[n] : aii[n]);
+        for (int j = 0; j < 2; j++)
+          for (int n = 0; n < N; n++)
+            coeff_mat(*mat, f, i, j, n, N) += (i == j ? 1.0 : -1.0) * coeff * (j ? ajj[n] : aii[n]);
     }
   else
     for (auto &&d_m_i : d_cc)
@@ -389,9 +389,9 @@ inline void Iterateur_VDF_Elem<_TYPE_>::fill_coeffs_matrices(const int face, Typ
   if (mat)
     {
       if (e0 > -1)
-        for (int n = 0; n < N; n++) (*mat)(e0 * N + n, e0 * N + n) += aii[n];
+        for (int n = 0; n < N; n++) coeff_mat(*mat, face, 0, 0, n, N) += aii[n];
       if (e1 > -1)
-        for (int n = 0; n < N; n++) (*mat)(e1 * N + n, e1 * N + n) += ajj[n];
+        for (int n = 0; n < N; n++) coeff_mat(*mat, face, 1, 1, n, N) += ajj[n];
     }
   else
     for (auto &&d_m_i : d_cc)
@@ -415,6 +415,24 @@ inline void Iterateur_VDF_Elem<_TYPE_>::fill_coeffs_matrices(const int face, Typ
       }
 }
 
+template<class _TYPE_>
+inline double& Iterateur_VDF_Elem<_TYPE_>::coeff_mat(Matrice_Morse& mat, const int f, const int i, const int j, const int n, const int N) const
+{
+  if (mat_places_ != &mat || places_mat_.size_array() != 4 * N * elem.dimension_tot(0))
+    {
+      places_mat_.resize(elem.dimension_tot(0), 4, N);
+      places_mat_ = -1;
+      mat_places_ = &mat;
+    }
+  const int ligne = N * elem(f, i) + n, colonne = N * elem(f, j) + n;
+  int& k = places_mat_(f, 2 * i + j, n);
+  // Phase symbolique : au premier assemblage, ou si la place enregistree ne designe plus M(ligne, colonne) (stencil modifie)
+  if (k < 0 || !mat.indice_designe(k, ligne, colonne))
+    k = mat.indice(ligne, colonne);
+  // Phase numerique : ecriture directe ; case absente du stencil : operator() s'arrete en erreur (ou renvoie zero_ pour Matrice_Morse_Diag)
+  return k < 0 ? mat(ligne, colonne) : mat.get_set_coeff()[k];
+}
+
 #include <Iterateur_VDF_Elem_bis.tpp>
 #include <Iterateur_VDF_Elem_FT_TCL.tpp> // pour FT ...
 
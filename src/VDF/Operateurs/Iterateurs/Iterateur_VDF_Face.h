@@ -45,6 +45,15 @@ public:
   // INTERFACE  BLOCS
   void ajouter_blocs(matrices_t mats, DoubleTab& secmem, const tabs_t& semi_impl) const override;
 
+  // BALAYAGE FUSIONNE (second membre seulement)
+  bool balayage_fusionnable() const override { return true; }
+  int nb_aretes_internes_fusion() const override { return _TYPE_::CALC_ARR_INT ? derniere_arete_interne - premiere_arete_interne : 0; }
+  int nb_elem_fusion() const override { return nb_elem; }
+  void ajouter_blocs_fusion_debut(DoubleTab& secmem, const tabs_t& semi_impl) const override;
+  void ajouter_blocs_fusion_aretes_internes(const int debut, const int fin, DoubleTab& secmem, const tabs_t& semi_impl) const override;
+  void ajouter_blocs_fusion_fa7_elem(const int debut, const int fin, DoubleTab& secmem, const tabs_t& semi_impl) const override;
+  void ajouter_blocs_fusion_fin(DoubleTab& secmem, const tabs_t& semi_impl) const override;
+
 protected:
   _TYPE_ flux_evaluateur;
   int nb_elem = -100, premiere_arete_interne = -100, derniere_arete_interne = -100, premiere_arete_mixte = -100, derniere_arete_mixte = -100;
@@ -118,6 +127,9 @@ private:
   template<typename Type_Double>
   void ajouter_blocs_fa7_elem(const int, matrices_t, DoubleTab&, const tabs_t& ) const;
 
+  template<typename Type_Double>
+  void ajouter_blocs_fa7_elem_tranche(const int, const int, const int, DoubleTab&, const tabs_t& ) const;
+
   void corriger_fa7_elem_periodicite__(const int, int&, int&, int&, int&) const;
   template<typename Type_Double> void corriger_fa7_elem_periodicite(const int, matrices_t, DoubleTab&, const tabs_t& ) const;
 
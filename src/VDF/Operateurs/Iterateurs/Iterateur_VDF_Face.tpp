@@ -63,6 +63,85 @@ void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs(matrices_t mats, DoubleTab& secme
   if (!is_pb_multi) multiply_by_rho_if_hydraulique(tab_flux_bords);
 }
 
+/*! @brief Debut du balayage fusionne : tout ce qui precede les aretes internes et les fa7 elem dans ajouter_blocs.
+ *
+ * @sa Iterateur_VDF_base::ajouter_blocs_fusionnes
+ */
+template<class _TYPE_>
+void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fusion_debut(DoubleTab& secmem, const tabs_t& semi_impl) const
+{
+  ((_TYPE_&) flux_evaluateur).mettre_a_jour();
+  assert(op_base->equation().inconnue().valeurs().nb_dim() < 3);
+  const int ncomp = op_base->equation().inconnue().valeurs().line_size();
+  DoubleTab& tab_flux_bords = op_base->flux_bords();
+  tab_flux_bords.resize(le_dom->nb_faces_bord(), dimension);
+  tab_flux_bords = 0.;
+
+  if (ncomp == 1)
+    {
+      ajouter_blocs_aretes_bords<SingleDouble>(ncomp, {}, secmem, semi_impl);
+      ajouter_blocs_aretes_coins<SingleDouble>(ncomp, {}, secmem, semi_impl);
+      ajouter_blocs_aretes_mixtes<SingleDouble>(ncomp, {}, secmem, semi_impl);
+      ajouter_blocs_fa7_sortie_libre<SingleDouble>(ncomp, {}, secmem, semi_impl);
+    }
+  else
+    {
+      ajouter_blocs_aretes_bords<ArrOfDouble>(ncomp, {}, secmem, semi_impl);
+      ajouter_blocs_aretes_coins<ArrOfDouble>(ncomp, {}, secmem, semi_impl);
+      ajouter_blocs_aretes_mixtes<ArrOfDouble>(ncomp, {}, secmem, semi_impl);
+      ajouter_blocs_fa7_sortie_libre<ArrOfDouble>(ncomp, {}, secmem, semi_impl);
+    }
+}
+
+template<class _TYPE_>
+void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fusion_aretes_internes(const int debut, const int fin, DoubleTab& secmem, const tabs_t& semi_impl) const
+{
+  if(!_TYPE_::CALC_ARR_INT) return; /* do nothing */
+
+  const int n_aretes = nb_aretes_internes_fusion(), fin_ = std::min(fin, n_aretes);
+  if (debut >= fin_) return;
+
+  const int ncomp = op_base->equation().inconnue().valeurs().line_size();
+  if (ncomp == 1)
+    ajouter_blocs_aretes_generique_<true, Type_Flux_Arete::INTERNE, SingleDouble>(premiere_arete_interne + debut, premiere_arete_interne + fin_, ncomp, {}, secmem, semi_impl);
+  else
+    ajouter_blocs_aretes_generique_<true, Type_Flux_Arete::INTERNE, ArrOfDouble>(premiere_arete_interne + debut, premiere_arete_interne + fin_, ncomp, {}, secmem, semi_impl);
+}
+
+template<class _TYPE_>
+void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fusion_fa7_elem(const int debut, const int fin, DoubleTab& secmem, const tabs_t& semi_impl) const
+{
+  const int fin_ = std::min(fin, nb_elem);
+  if (debut >= fin_) return;
+
+  const int ncomp = op_base->equation().inconnue().valeurs().line_size();
+  if (ncomp == 1)
+    ajouter_blocs_fa7_elem_tranche<SingleDouble>(debut, fin_, ncomp, secmem, semi_impl);
+  else
+    ajouter_blocs_fa7_elem_tranche<ArrOfDouble>(debut, fin_, ncomp, secmem, semi_impl);
+}
+
+template<class _TYPE_>
+void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fusion_fin(DoubleTab& secmem, const tabs_t& semi_impl) const
+{
+  const int ncomp = op_base->equation().inconnue().valeurs().line_size();
+  if (ncomp == 1)
+    corriger_fa7_elem_periodicite<SingleDouble>(ncomp, {}, secmem, semi_impl);
+  else
+    corriger_fa7_elem_periodicite<ArrOfDouble>(ncomp, {}, secmem, semi_impl);
+
+  if (!incompressible_ )
+    {
+      assert (is_pb_multi && is_conv_op_);
+      if (ncomp == 1)
+        ajouter_pour_compressible<SingleDouble>(ncomp, {}, secmem, semi_impl);
+      else
+        ajouter_pour_compressible<ArrOfDouble>(ncomp, {}, secmem, semi_impl);
+    }
+
+  if (!is_pb_multi) multiply_by_rho_if_hydraulique(op_base->flux_bords());
+}
+
 /* ================== *
  * ====== BORDS =====
  * ================== */
@@ -556,28 +635,12 @@ void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fa7_sortie_libre_(const int num_c
 template<class _TYPE_> template <typename Type_Double>
 void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fa7_elem(const int ncomp, matrices_t mats, DoubleTab& secmem, const tabs_t& semi_impl) const
 {
-  DoubleTab& tab_flux_bords = op_base->flux_bords();
-  const DoubleTab& inco = semi_impl.count(nom_ch_inco_) ? semi_impl.at(nom_ch_inco_) : le_champ_convecte_ou_inc->valeurs();
-  Type_Double flux(ncomp), aii(ncomp), ajj(ncomp);
-  const int n_fc_bd = le_dom->nb_faces_bord();
-
+  Type_Double aii(ncomp), ajj(ncomp);
   const DoubleTab* a_r = (!is_pb_multi || !is_conv_op_) ? nullptr : semi_impl.count("alpha_rho") ? &semi_impl.at("alpha_rho") :
                          &ref_cast(Pb_Multiphase,op_base->equation().probleme()).equation_masse().champ_conserve().valeurs();
-//  const IntTab& f_e = le_dom->face_voisins();
-  // second membre
-  for (int num_elem = 0; num_elem < nb_elem; num_elem++)
-    for (int fa7 = 0; fa7 < dimension; fa7++)
-      {
-        int fac1 = elem_faces(num_elem, fa7), fac2 = elem_faces(num_elem, fa7 + dimension);
-        flux_evaluateur.template flux_fa7 < Type_Flux_Fa7::ELEM > (inco, a_r, num_elem, fac1, fac2, flux);
-        fill_resu_tab < Type_Double > (fac1, fac2, ncomp, flux, secmem);
 
-        if (fac1 < n_fc_bd)
-          for (int k = 0; k < ncomp; k++) tab_flux_bords(fac1, orientation(fac1)) += flux[k];
-
-        if (fac2 < n_fc_bd)
-          for (int k = 0; k < ncomp; k++) tab_flux_bords(fac2, orientation(fac2)) -= flux[k];
-      }
+  // second membre
+  ajouter_blocs_fa7_elem_tranche<Type_Double>(0, nb_elem, ncomp, secmem, semi_impl);
 
   // derivees : champ convecte
   Matrice_Morse *matrice = (is_pb_multi && is_conv_op_) ? (mats.count(nom_ch_inco_) && !semi_impl.count(nom_ch_inco_) ? mats.at(nom_ch_inco_) : nullptr) : (mats.count(nom_ch_inco_) ? mats.at(nom_ch_inco_) : nullptr);
@@ -597,6 +660,32 @@ void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fa7_elem(const int ncomp, matrice
   corriger_fa7_elem_periodicite<Type_Double>(ncomp, mats, secmem, semi_impl);
 }
 
+template<class _TYPE_> template <typename Type_Double>
+void Iterateur_VDF_Face<_TYPE_>::ajouter_blocs_fa7_elem_tranche(const int debut, const int fin, const int ncomp, DoubleTab& secmem, const tabs_t& semi_impl) const
+{
+  DoubleTab& tab_flux_bords = op_base->flux_bords();
+  const DoubleTab& inco = semi_impl.count(nom_ch_inco_) ? semi_impl.at(nom_ch_inco_) : le_champ_convecte_ou_inc->valeurs();
+  Type_Double flux(ncomp);
+  const int n_fc_bd = le_dom->nb_faces_bord();
+
+  const DoubleTab* a_r = (!is_pb_multi || !is_conv_op_) ? nullptr : semi_impl.count("alpha_rho") ? &semi_impl.at("alpha_rho") :
+                         &ref_cast(Pb_Multiphase,op_base->equation().probleme()).equation_masse().champ_conserve().valeurs();
+//  const IntTab& f_e = le_dom->face_voisins();
+  for (int num_elem = debut; num_elem < fin; num_elem++)
+    for (int fa7 = 0; fa7 < dimension; fa7++)
+      {
+        int fac1 = elem_faces(num_elem, fa7), fac2 = elem_faces(num_elem, fa7 + dimension);
+        flux_evaluateur.template flux_fa7 < Type_Flux_Fa7::ELEM > (inco, a_r, num_elem, fac1, fac2, flux);
+        fill_resu_tab < Type_Double > (fac1, fac2, ncomp, flux, secmem);
+
+        if (fac1 < n_fc_bd)
+          for (int k = 0; k < ncomp; k++) tab_flux_bords(fac1, orientation(fac1)) += flux[k];
+
+        if (fac2 < n_fc_bd)
+          for (int k = 0; k < ncomp; k++) tab_flux_bords(fac2, orientation(fac2)) -= flux[k];
+      }
+}
+
 template<class _TYPE_> template<typename Type_Double>
 void Iterateur_VDF_Face<_TYPE_>::corriger_fa7_elem_periodicite(const int ncomp, matrices_t mats, DoubleTab& secmem, const tabs_t& semi_impl) const
 {
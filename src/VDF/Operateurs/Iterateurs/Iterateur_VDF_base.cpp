@@ -14,6 +14,7 @@
 *****************************************************************************/
 
 #include <Iterateur_VDF_base.h>
+#include <stat_counters.h>
 
 Implemente_base(Iterateur_VDF_base, "Iterateur_VDF_base", Objet_U);
 
@@ -39,3 +40,68 @@ void Iterateur_VDF_base::associer_champ_convecte_ou_inc(const Champ_Inc_base& ch
   if (chv) le_ch_v = *chv;
   use_base_val_b_ = use;
 }
+
+static void erreur_balayage_fusionne(const Iterateur_VDF_base& it, const char* methode)
+{
+  Cerr << it.que_suis_je() << "::" << methode << " should not be called : this iterator does not support the fused sweep !" << finl;
+  Process::exit();
+}
+
+void Iterateur_VDF_base::ajouter_blocs_fusion_debut(DoubleTab&, const tabs_t&) const { erreur_balayage_fusionne(*this, __func__); }
+void Iterateur_VDF_base::ajouter_blocs_fusion_aretes_internes(const int, const int, DoubleTab&, const tabs_t&) const { erreur_balayage_fusionne(*this, __func__); }
+void Iterateur_VDF_base::ajouter_blocs_fusion_fa7_elem(const int, const int, DoubleTab&, const tabs_t&) const { erreur_balayage_fusionne(*this, __func__); }
+void Iterateur_VDF_base::ajouter_blocs_fusion_fin(DoubleTab&, const tabs_t&) const { erreur_balayage_fusionne(*this, __func__); }
+
+/*! @brief Ajoute a secmem les contributions des deux iterateurs en un seul balayage des aretes internes puis des elements.
+ *
+ * Les boucles sont decoupees en tranches parcourues successivement par it1 puis it2 : les faces et les valeurs
+ *  de l'inconnue lues par it1 sont encore en cache quand it2 traite la meme tranche. Les parties hors boucles
+ *  principales (bords, coins, aretes mixtes, periodicite...) sont traitees avant et apres comme dans ajouter_blocs.
+ *  Seul l'ordre des sommations change par rapport a deux appels successifs a ajouter_blocs.
+ */
+void Iterateur_VDF_base::ajouter_blocs_fusionnes(const Iterateur_VDF_base& it1, const Iterateur_VDF_base& it2, const Stat_Counter_Id& compteur1, const Stat_Counter_Id& compteur2,
+                                                 DoubleTab& secmem, const tabs_t& semi_impl)
+{
+  constexpr int taille_tranche = 1024;
+  assert(it1.balayage_fusionnable() && it2.balayage_fusionnable());
+  // le temps de chaque iterateur est compte dans le compteur de son operateur (compteur1 pour it1, compteur2 pour it2)
+  Statistiques& stats = statistiques();
+
+  stats.begin_count(compteur1);
+  it1.ajouter_blocs_fusion_debut(secmem, semi_impl);
+  stats.end_count(compteur1);
+  stats.begin_count(compteur2);
+  it2.ajouter_blocs_fusion_debut(secmem, semi_impl);
+  stats.end_count(compteur2);
+
+  const int nb_aretes = std::max(it1.nb_aretes_internes_fusion(), it2.nb_aretes_internes_fusion());
+  for (int debut = 0; debut < nb_aretes; debut += taille_tranche)
+    {
+      const int fin = std::min(debut + taille_tranche, nb_aretes);
+      stats.begin_count(compteur1, false);
+      it1.ajouter_blocs_fusion_aretes_internes(debut, fin, secmem, semi_impl);
+      stats.end_count(compteur1, 0, 0, false);
+      stats.begin_count(compteur2, false);
+      it2.ajouter_blocs_fusion_aretes_internes(debut, fin, secmem, semi_impl);
+      stats.end_count(compteur2, 0, 0, false);
+    }
+
+  const int nb_elem = std::max(it1.nb_elem_fusion(), it2.nb_elem_fusion());
+  for (int debut = 0; debut < nb_elem; debut += taille_tranche)
+    {
+      const int fin = std::min(debut + taille_tranche, nb_elem);
+      stats.begin_count(compteur1, false);
+      it1.ajouter_blocs_fusion_fa7_elem(debut, fin, secmem, semi_impl);
+      stats.end_count(compteur1, 0, 0, false);
+      stats.begin_count(compteur2, false);
+      it2.ajouter_blocs_fusion_fa7_elem(debut, fin, secmem, semi_impl);
+      stats.end_count(compteur2, 0, 0, false);
+    }
+
+  stats.begin_count(compteur1);
+  it1.ajouter_blocs_fusion_fin(secmem, semi_impl);
+  stats.end_count(compteur1);
+  stats.begin_count(compteur2);
+  it2.ajouter_blocs_fusion_fin(secmem, semi_impl);
+  stats.end_count(compteur2);
+}
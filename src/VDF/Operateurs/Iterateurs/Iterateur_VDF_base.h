@@ -30,6 +30,7 @@
 #include <TRUSTTrav.h>
 #include <TRUST_Ref.h>
 
+class Stat_Counter_Id;
 class Champ_Inc_base;
 class Operateur_base;
 class Champ_base;
@@ -68,6 +69,17 @@ public:
     Process::exit();
   }
 
+  /* Balayage fusionne de deux operateurs (cf Op_Diff_VDF_base::ajouter_fusionne_) : second membre seulement, par tranches */
+  virtual bool balayage_fusionnable() const { return false; }
+  virtual int nb_aretes_internes_fusion() const { return 0; }
+  virtual int nb_elem_fusion() const { return 0; }
+  virtual void ajouter_blocs_fusion_debut(DoubleTab& secmem, const tabs_t& semi_impl) const;
+  virtual void ajouter_blocs_fusion_aretes_internes(const int debut, const int fin, DoubleTab& secmem, const tabs_t& semi_impl) const;
+  virtual void ajouter_blocs_fusion_fa7_elem(const int debut, const int fin, DoubleTab& secmem, const tabs_t& semi_impl) const;
+  virtual void ajouter_blocs_fusion_fin(DoubleTab& secmem, const tabs_t& semi_impl) const;
+  static void ajouter_blocs_fusionnes(const Iterateur_VDF_base& it1, const Iterateur_VDF_base& it2, const Stat_Counter_Id& compteur1, const Stat_Counter_Id& compteur2,
+                                      DoubleTab& secmem, const tabs_t& semi_impl);
+
   virtual void completer_()=0;
   virtual int impr(Sortie& os) const=0;
   virtual Evaluateur_VDF& evaluateur() =0;
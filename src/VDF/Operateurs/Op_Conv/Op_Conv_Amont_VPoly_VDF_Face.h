@@ -25,6 +25,7 @@ public:
   Op_Conv_Amont_VPoly_VDF_Face() : Op_Conv_Amont_VDF_Face() { /* on initialise l'iter juste pour les domaines, cl, blabla */ }
   void dimensionner_blocs(matrices_t mats, const tabs_t& semi_impl) const override { Op_Conv_VDF_base::dimensionner_blocs_face(mats, semi_impl); }
   void ajouter_blocs(matrices_t matrices, DoubleTab& secmem, const tabs_t& semi_impl = {}) const override;
+  bool balayage_fusionnable() const override { return false; } // ajouter_blocs specifique
 };
 
 #endif /* Op_Conv_Amont_VPoly_VDF_Face_included */
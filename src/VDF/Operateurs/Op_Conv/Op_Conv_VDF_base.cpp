@@ -182,6 +182,16 @@ void Op_Conv_VDF_base::ajouter_blocs(matrices_t mats, DoubleTab& secmem, const t
 }
 
 double Op_Conv_VDF_base::calculer_dt_stab() const
+{
+  const double dt_stab = Process::mp_min(calculer_dt_stab_local());
+  // astuce pour contourner le type const de la methode
+  Op_Conv_VDF_base& op =ref_cast_non_const(Op_Conv_VDF_base, *this);
+  op.fixer_dt_stab_conv(dt_stab);
+  return dt_stab;
+}
+
+// Pas de temps de stabilite sur le processeur courant (le mp_min et fixer_dt_stab_conv sont faits par l'appelant)
+double Op_Conv_VDF_base::calculer_dt_stab_local() const
 {
   const Domaine_VDF& domaine_VDF = iter->domaine();
   const Domaine_Cl_VDF& domaine_Cl_VDF = iter->domaine_Cl();
@@ -250,11 +260,6 @@ double Op_Conv_VDF_base::calculer_dt_stab() const
           if (dt_elem<dt_stab) dt_stab = dt_elem;
         }
 
-  dt_stab = Process::mp_min(dt_stab);
-
-  // astuce pour contourner le type const de la methode
-  Op_Conv_VDF_base& op =ref_cast_non_const(Op_Conv_VDF_base, *this);
-  op.fixer_dt_stab_conv(dt_stab);
   return dt_stab;
 }
 
@@ -38,6 +38,7 @@ public:
   void mettre_a_jour(double ) override;
 
   double calculer_dt_stab() const override;
+  double calculer_dt_stab_local() const override;
   int impr(Sortie& os) const override;
   Motcle get_localisation_pour_post(const Nom& option) const override;
   virtual const Champ_base& vitesse() const = 0;
@@ -45,6 +46,7 @@ public:
   inline DoubleTab& calculer(const DoubleTab& inco, DoubleTab& resu ) const override { return iter->calculer(inco, resu); }
   inline const Iterateur_VDF& get_iter() const { return iter; }
   inline Iterateur_VDF& get_iter() { return iter; }
+  virtual bool balayage_fusionnable() const { return iter->balayage_fusionnable(); } // cf Op_Diff_VDF_base::ajouter_fusionne_
 
   inline int has_interface_blocs() const override { return 1; }
 
@@ -28,6 +28,11 @@ Sortie& Op_Diff_VDF_Elem_base::printOn(Sortie& s ) const { return s << que_suis_
 Entree& Op_Diff_VDF_Elem_base::readOn(Entree& s ) { return s ; }
 
 double Op_Diff_VDF_Elem_base::calculer_dt_stab() const
+{
+  return Process::mp_min(calculer_dt_stab_local());
+}
+
+double Op_Diff_VDF_Elem_base::calculer_dt_stab_local() const
 {
   // Calcul du pas de temps de stabilite :
   //
@@ -58,7 +63,7 @@ double Op_Diff_VDF_Elem_base::calculer_dt_stab() const
 
       if (alpha==0) dt_stab = DMAXFLOAT;
       else dt_stab = 0.5/(alpha*coef);
-      return Process::mp_min(dt_stab);
+      return dt_stab;
     }
 
   return Op_Diff_VDF_base::calculer_dt_stab_(domaine_VDF);
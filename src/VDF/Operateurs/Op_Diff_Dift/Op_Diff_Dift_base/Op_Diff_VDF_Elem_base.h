@@ -39,6 +39,7 @@ public:
   }
 
   double calculer_dt_stab() const override;
+  double calculer_dt_stab_local() const override;
   void dimensionner_termes_croises(Matrice_Morse&, const Probleme_base& autre_pb, int nl, int nc) const override;
   void contribuer_termes_croises(const DoubleTab& inco, const Probleme_base& autre_pb, const DoubleTab& autre_inco,  Matrice_Morse& matrice) const override;
   void dimensionner_blocs(matrices_t matrices, const tabs_t& semi_impl) const override;
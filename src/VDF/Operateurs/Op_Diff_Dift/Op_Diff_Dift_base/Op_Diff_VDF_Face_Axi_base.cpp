@@ -41,6 +41,11 @@ void Op_Diff_VDF_Face_Axi_base::associer(const Domaine_dis& domaine_dis, const D
 }
 
 double Op_Diff_VDF_Face_Axi_base::calculer_dt_stab() const
+{
+  return Process::mp_min(calculer_dt_stab_local());
+}
+
+double Op_Diff_VDF_Face_Axi_base::calculer_dt_stab_local() const
 {
   return Op_Diff_VDF_base::calculer_dt_stab_(le_dom_vdf.valeur()) ;
 }
@@ -26,8 +26,10 @@ class Op_Diff_VDF_Face_Axi_base : public Op_Diff_VDF_Face_base
   Declare_base(Op_Diff_VDF_Face_Axi_base);
 public:
   double calculer_dt_stab() const override;
+  double calculer_dt_stab_local() const override;
   void associer(const Domaine_dis& , const Domaine_Cl_dis& , const Champ_Inc& ) override;
   DoubleTab& calculer(const DoubleTab& , DoubleTab& ) const override;
+  int ajouter_fusionne(const Operateur_base&, const DoubleTab&, DoubleTab&) const override { return 0; } // pas d'iterateur
 
   inline void mettre_a_jour(double temps) override { }
   inline void contribuer_a_avec(const DoubleTab& inco, Matrice_Morse& matrice) const override { ajouter_contribution(inco, matrice); }
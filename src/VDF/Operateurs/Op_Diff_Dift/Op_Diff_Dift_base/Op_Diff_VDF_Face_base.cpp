@@ -48,5 +48,19 @@ void Op_Diff_VDF_Face_base::ajouter_blocs(matrices_t matrices, DoubleTab& secmem
   statistiques().end_count(diffusion_counter_);
 }
 
-double Op_Diff_VDF_Face_base::calculer_dt_stab() const { return Op_Diff_VDF_base::calculer_dt_stab_(iter->domaine()); }
+int Op_Diff_VDF_Face_base::ajouter_fusionne(const Operateur_base& conv, const DoubleTab& inco, DoubleTab& secmem) const
+{
+  assert_invalide_items_non_calcules(secmem, 0.);
+  if (!Op_Diff_VDF_base::ajouter_fusionne_(conv, inco, secmem)) return 0;
+
+  // On ajoute des termes si axi ...
+  statistiques().begin_count(diffusion_counter_);
+  Op_Diff_VDF_base::ajoute_terme_pour_axi({}, secmem, {{ equation().inconnue().le_nom().getString(), inco }});
+  statistiques().end_count(diffusion_counter_);
+  return 1;
+}
+
+double Op_Diff_VDF_Face_base::calculer_dt_stab() const { return Process::mp_min(calculer_dt_stab_local()); }
+
+double Op_Diff_VDF_Face_base::calculer_dt_stab_local() const { return Op_Diff_VDF_base::calculer_dt_stab_(iter->domaine()); }
 
@@ -34,8 +34,10 @@ public:
   }
 
   double calculer_dt_stab() const override;
+  double calculer_dt_stab_local() const override;
   void dimensionner_blocs(matrices_t matrices, const tabs_t& semi_impl) const override;
   void ajouter_blocs(matrices_t matrices, DoubleTab& secmem, const tabs_t& semi_impl) const override;
+  int ajouter_fusionne(const Operateur_base& conv, const DoubleTab& inco, DoubleTab& secmem) const override;
   inline void modifier_pour_Cl(Matrice_Morse& matrice, DoubleTab& secmem) const override { Op_VDF_Face::modifier_pour_Cl(iter->domaine(), iter->domaine_Cl(), matrice, secmem); }
 };
 
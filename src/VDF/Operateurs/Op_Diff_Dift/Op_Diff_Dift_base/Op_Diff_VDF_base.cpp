@@ -15,6 +15,8 @@
 
 #include <Echange_contact_VDF.h>
 #include <Op_Diff_VDF_base.h>
+#include <Op_Conv_VDF_base.h>
+#include <Statistiques.h>
 #include <Champ_front_calc.h>
 #include <Eval_Diff_VDF.h>
 #include <Pb_Multiphase.h>
@@ -42,6 +44,30 @@ void Op_Diff_VDF_base::completer()
     }
 }
 
+/*! @brief Ajoute a secmem la diffusion et la convection conv en un seul balayage par tranches des aretes et des elements.
+ *
+ * Renvoie 0 sans rien ajouter si conv n'est pas un operateur de convection VDF ou si l'un des iterateurs ne supporte pas
+ *  le balayage fusionne (operateurs aux elements, Axi...). Les termes propres a chaque operateur diffusif (axi) sont
+ *  ajoutes par l'appelant.
+ *
+ * @sa Iterateur_VDF_base::ajouter_blocs_fusionnes
+ */
+int Op_Diff_VDF_base::ajouter_fusionne_(const Operateur_base& conv, const DoubleTab& inco, DoubleTab& secmem) const
+{
+  if (!iter.non_nul() || !sub_type(Op_Conv_VDF_base, conv)) return 0;
+
+  const Op_Conv_VDF_base& op_conv = ref_cast(Op_Conv_VDF_base, conv);
+  if (!op_conv.balayage_fusionnable() || !iter->balayage_fusionnable()) return 0;
+
+  const Iterateur_VDF& iter_conv = op_conv.get_iter();
+  if (&iter_conv->domaine() != &iter->domaine()) return 0;
+
+  // chaque tranche est comptee dans le compteur de son operateur (diffusion ou convection)
+  Iterateur_VDF_base::ajouter_blocs_fusionnes(iter.valeur(), iter_conv.valeur(), diffusion_counter_, convection_counter_, secmem,
+  {{ equation().inconnue().le_nom().getString(), inco }});
+  return 1;
+}
+
 int Op_Diff_VDF_base::impr(Sortie& os) const
 {
   // Certains operateurs (Axi) n'ont pas d'iterateurs en VDF... Encore une anomalie dans la conception a corriger un jour !
@@ -195,5 +221,6 @@ double Op_Diff_VDF_base::calculer_dt_stab_(const Domaine_VDF& zone_VDF) const
         }
     }
 
-  return Process::mp_min(dt_stab);
+  // Valeur locale : le mp_min est fait par l'appelant
+  return dt_stab;
 }
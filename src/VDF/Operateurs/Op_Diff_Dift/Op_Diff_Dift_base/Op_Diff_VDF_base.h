@@ -47,6 +47,7 @@ public:
 protected:
   double calculer_dt_stab_(const Domaine_VDF& zone_VDF) const;
   void ajoute_terme_pour_axi(matrices_t , DoubleTab& , const tabs_t& ) const;
+  int ajouter_fusionne_(const Operateur_base& conv, const DoubleTab& inco, DoubleTab& secmem) const;
 
   Iterateur_VDF iter;
   mutable int op_ext_init_ = 0;
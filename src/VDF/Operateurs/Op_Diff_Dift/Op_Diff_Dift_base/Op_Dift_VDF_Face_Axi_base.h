@@ -33,6 +33,7 @@ public:
   void mettre_a_jour(double ) override;
   void contribue_au_second_membre(DoubleTab& ) const;
   DoubleTab& calculer(const DoubleTab& , DoubleTab& ) const override;
+  int ajouter_fusionne(const Operateur_base&, const DoubleTab&, DoubleTab&) const override { return 0; } // pas d'iterateur
 
   inline void contribuer_a_avec(const DoubleTab& inco, Matrice_Morse& matrice) const override { ajouter_contribution(inco, matrice); }
   inline void contribuer_au_second_membre(DoubleTab& resu) const override { contribue_au_second_membre(resu); }
@@ -40,6 +40,17 @@ void Op_Dift_VDF_base::ajouter_blocs(matrices_t matrices, DoubleTab& secmem, con
   statistiques().end_count(diffusion_counter_);
 }
 
+int Op_Dift_VDF_base::ajouter_fusionne(const Operateur_base& conv, const DoubleTab& inco, DoubleTab& secmem) const
+{
+  if (!Op_Diff_VDF_base::ajouter_fusionne_(conv, inco, secmem)) return 0;
+
+  // On ajoute des termes si axi ...
+  statistiques().begin_count(diffusion_counter_);
+  Op_Dift_VDF_base::ajoute_terme_pour_axi_turb({}, secmem, {{ equation().inconnue().le_nom().getString(), inco }});
+  statistiques().end_count(diffusion_counter_);
+  return 1;
+}
+
 // Ajout du terme supplementaire en V/(R*R) dans le cas des coordonnees axisymetriques
 void Op_Dift_VDF_base::ajoute_terme_pour_axi_turb(matrices_t matrices, DoubleTab& secmem, const tabs_t& semi_impl) const
 {
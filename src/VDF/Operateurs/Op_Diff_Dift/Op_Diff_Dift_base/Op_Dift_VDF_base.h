@@ -25,6 +25,7 @@ class Op_Dift_VDF_base : public Op_Diff_VDF_base, public Op_Diff_Turbulent_base
 public:
   inline Op_Dift_VDF_base(const Iterateur_VDF_base& iter_base) : Op_Diff_VDF_base(iter_base) { }
   void ajouter_blocs(matrices_t matrices, DoubleTab& secmem, const tabs_t& semi_impl) const override;
+  int ajouter_fusionne(const Operateur_base& conv, const DoubleTab& inco, DoubleTab& secmem) const override;
 
   void contribuer_au_second_membre(DoubleTab& ) const override
   {
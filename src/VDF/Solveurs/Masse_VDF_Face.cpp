@@ -126,22 +126,24 @@ void Masse_VDF_Face::ajouter_blocs(matrices_t matrices, DoubleTab& secmem, doubl
       const DoubleTab& rho = equation().milieu().masse_volumique().passe(),
                        *alpha = pbm ? &pbm->equation_masse().inconnue().passe() : nullptr, *a_r = pbm ? &pbm->equation_masse().champ_conserve().passe() : nullptr, &vfd = domaine.volumes_entrelaces_dir();
       const Masse_ajoutee_base *corr = pbm && pbm->has_correlation("masse_ajoutee") ? &ref_cast(Masse_ajoutee_base, pbm->get_correlation("masse_ajoutee").valeur()) : nullptr;
-      int i, e, f, m, n, N = inco.line_size(), d, D = dimension, cR = rho.dimension_tot(0) == 1;
+      int i, e, f, m, n, N = inco.line_size(), d, D = dimension;
+
+      /* alpha * rho (+ masse ajoutee) aux elements : calcule une seule fois, puis interpole aux faces */
+      DoubleTrav masse_e(domaine.nb_elem_tot(), N, N);
+      for (e = 0; e < domaine.nb_elem_tot(); e++)
+        for (n = 0; n < N; n++) masse_e(e, n, n) = (*a_r)(e, n); //partie diagonale
+      if (corr) corr->ajouter_lot(*alpha, rho, masse_e); //partie masse ajoutee
 
       /* faces : si CLs, pas de produit par alpha * rho en multiphase */
-      DoubleTrav masse(N, N), masse_e(N, N); //masse alpha * rho, contribution
+      DoubleTrav masse(N, N); //masse alpha * rho
       for (f = 0; f < domaine.nb_faces(); f++) //faces reelles
         {
           if (!pbm || fcl(f, 0) >= 2)
             for (masse = 0, n = 0; n < N; n++) masse(n, n) = 1; //pas Pb_Multiphase ou CL -> pas de alpha * rho
           else for (masse = 0, i = 0; i < 2; i++)
               if ((e = f_e(f, i)) >= 0)
-                {
-                  for (masse_e = 0, n = 0; n < N; n++) masse_e(n, n) = (*a_r)(e, n); //partie diagonale
-                  if (corr) corr->ajouter(&(*alpha)(e, 0), &rho(!cR * e, 0), masse_e); //partie masse ajoutee
-                  for (n = 0; n < N; n++)
-                    for (m = 0; m < N; m++) masse(n, m) += vfd(f, i) / vf(f) * masse_e(n, m); //contribution au alpha * rho de la face
-                }
+                for (n = 0; n < N; n++)
+                  for (m = 0; m < N; m++) masse(n, m) += vfd(f, i) / vf(f) * masse_e(e, n, m); //contribution au alpha * rho de la face
           for (n = 0; n < N; n++)
             {
               double fac = pf(f) * vf(f) / dt;
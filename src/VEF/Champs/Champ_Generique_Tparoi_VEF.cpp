@@ -71,7 +71,7 @@ const Champ_base& Champ_Generique_Tparoi_VEF::get_champ(Champ& espace_stockage)
 {
 
   Champ source_espace_stockage;
-  const Champ_base& source = get_source(0).get_champ(source_espace_stockage);
+  const Champ_base& source = get_source(0).get_champ_memorise(source_espace_stockage);
 
   const Domaine_dis_base& domaine_dis = get_ref_domaine_dis_base();
   Nature_du_champ nature_source = source.nature_du_champ();
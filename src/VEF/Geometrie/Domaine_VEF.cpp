@@ -611,7 +611,7 @@ void Domaine_VEF::construire_ok_arete()
   ArrOfBit marqueurs_aretes;
   const MD_Vector& md_aretes = md_vector_aretes();
   MD_Vector_tools::get_sequential_items_flags(md_aretes, marqueurs_aretes);
-  const int nb_aretes_seq = md_aretes.valeur().nb_items_seq_tot();
+  const trustIdType nb_aretes_seq = md_aretes.valeur().nb_items_seq_tot();
 
   if (Process::je_suis_maitre())
     fic_ok_arete_ << nb_aretes_seq << finl;
@@ -903,7 +903,7 @@ int Domaine_VEF::lecture_ok_arete()
       return 0;
     }
 
-  int n;
+  trustIdType n;
   fic_ok_arete_ >> n;
   if (n != md_vector_aretes().valeur().nb_items_seq_tot())
     {
@@ -920,7 +920,7 @@ int Domaine_VEF::lecture_ok_arete()
   IntVect marqueurs;
   creer_tableau_aretes(marqueurs); // initialise a zero par defaut
 
-  for (int i = 0; i < n; i++)
+  for (trustIdType i = 0; i < n; i++)
     {
       double x, y, z;
       int flag;
@@ -842,6 +842,12 @@ DoubleTab& Op_Conv_Muscl_New_VEF_Face::ajouter(const DoubleTab& transporte_2,
   return resu;
 }
 
+// Avec facsec_auto_ la correction de dt_stab demande une reduction supplementaire: on renvoie la valeur deja reduite
+double Op_Conv_Muscl_New_VEF_Face::calculer_dt_stab_local() const
+{
+  return facsec_auto_ ? calculer_dt_stab() : Op_Conv_VEF_Face::calculer_dt_stab_local();
+}
+
 //ALGO TRES GROSSIER MAIS FONCTIONNE FACILEMENT
 double Op_Conv_Muscl_New_VEF_Face::calculer_dt_stab() const
 {
@@ -55,6 +55,7 @@ public:
   //Methodes pour l'explicite
   DoubleTab& ajouter(const DoubleTab& , DoubleTab& ) const override;
   double calculer_dt_stab() const override;
+  double calculer_dt_stab_local() const override;
 
   //Methodes pour l'implicite
   void contribuer_a_avec(const DoubleTab&, Matrice_Morse&) const override;
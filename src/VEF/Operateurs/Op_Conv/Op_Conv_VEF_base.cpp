@@ -61,6 +61,16 @@ void Op_Conv_VEF_base::abortTimeStep()
 }
 
 double Op_Conv_VEF_base::calculer_dt_stab() const
+{
+  const double dt_stab = Process::mp_min(calculer_dt_stab_local());
+  // astuce pour contourner le type const de la methode
+  Op_Conv_VEF_base& op = ref_cast_non_const(Op_Conv_VEF_base,*this);
+  op.fixer_dt_stab_conv(dt_stab);
+  return dt_stab;
+}
+
+// Pas de temps de stabilite sur le processeur courant (le mp_min et fixer_dt_stab_conv sont faits par l'appelant)
+double Op_Conv_VEF_base::calculer_dt_stab_local() const
 {
   const Domaine_Cl_VEF& domaine_Cl_VEF = la_zcl_vef.valeur();
   const Domaine_VEF& domaine_VEF = le_dom_vef.valeur();
@@ -133,10 +143,6 @@ double Op_Conv_VEF_base::calculer_dt_stab() const
         }
     }
   end_gpu_timer(kernelOnDevice, "Face loop in Op_Conv_VEF_base::calculer_dt_stab()");
-  dt_stab = Process::mp_min(dt_stab);
-  // astuce pour contourner le type const de la methode
-  Op_Conv_VEF_base& op = ref_cast_non_const(Op_Conv_VEF_base,*this);
-  op.fixer_dt_stab_conv(dt_stab);
   if (vitesse().le_nom()=="rho_u" && equation().probleme().is_dilatable())
     multiplier_par_rho_si_dilatable(fluent,equation().milieu());
 
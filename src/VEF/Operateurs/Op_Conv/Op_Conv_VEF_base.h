@@ -44,6 +44,7 @@ public:
   DoubleTab& calculer(const DoubleTab& , DoubleTab& ) const override;
   void abortTimeStep() override;
   double calculer_dt_stab() const override ;
+  double calculer_dt_stab_local() const override;
   void calculer_dt_local(DoubleTab&) const override ; //Local time step calculation
   void calculer_pour_post(Champ& espace_stockage,const Nom& option,int comp) const override;
   Motcle get_localisation_pour_post(const Nom& option) const override;
@@ -31,6 +31,10 @@
 #include <Check_espace_virtuel.h>
 #include <Solv_Petsc.h>
 #include <Matrice_Petsc.h>
+#include <Matrice_Morse_Sym.h>
+#include <View_Types.h>
+#include <vector>
+#include <map>
 
 Implemente_instanciable(Assembleur_P_VEFPreP1B,"Assembleur_P_VEFPreP1B",Assembleur_P_VEF);
 
@@ -94,6 +98,7 @@ void Assembleur_P_VEFPreP1B::completer(const Equation_base& eqn)
       beta=1./(Objet_U::dimension*(Objet_U::dimension+1));
     }
   la_matrice_de_travail_.typer("Matrice_Bloc_Sym");
+  invalider_structure_matrice();
 }
 
 const Domaine_VEF& Assembleur_P_VEFPreP1B::domaine_Vef() const
@@ -217,6 +222,7 @@ int Assembleur_P_VEFPreP1B::assembler_mat(Matrice& la_matrice,const DoubleVect&
   set_resoudre_en_u(resoudre_en_u);
 
   SolveurSys& solveur_pression = ref_cast(Navier_Stokes_std, mon_equation.valeur()).solveur_pression();
+  bool meme_stencil = false; // Vrai si seuls les coefficients de la matrice ont change depuis le precedent assemblage
   bool read_matrix = false;
   if (sub_type(Solv_Petsc, solveur_pression.valeur()))
     read_matrix = ref_cast(Solv_Petsc, solveur_pression.valeur()).read_matrix();
@@ -264,6 +270,7 @@ int Assembleur_P_VEFPreP1B::assembler_mat(Matrice& la_matrice,const DoubleVect&
       Matrice_Bloc_Sym& la_matrice_bloc_sym_de_travail = ref_cast(Matrice_Bloc_Sym, la_matrice_de_travail_.valeur());
       if (la_matrice_bloc_sym_de_travail.nb_bloc_lignes()==0)
         {
+          invalider_structure_matrice();
           la_matrice_bloc_sym_de_travail.dimensionner(nombre_supports, nombre_supports);
           if (domaine_vef.get_alphaE())
             assemblerP0P0(domaine_vef, domaine_Cl_VEF, la_matrice_bloc_sym_de_travail.get_bloc(P0, P0),
@@ -342,8 +349,21 @@ int Assembleur_P_VEFPreP1B::assembler_mat(Matrice& la_matrice,const DoubleVect&
       modifier_matrice(la_matrice_de_travail_);
 
       // Conversion eventuelle en Matrice_Morse_Sym
-      if (ref_cast(Navier_Stokes_std, mon_equation.valeur()).solveur_pression().supporte_matrice_morse_sym() &&
-          domaine_vef.get_alphaE() != nombre_supports) // On n'est pas en P0
+      const bool conversion_morse_sym = ref_cast(Navier_Stokes_std, mon_equation.valeur()).solveur_pression().supporte_matrice_morse_sym() &&
+                                        domaine_vef.get_alphaE() != nombre_supports; // On n'est pas en P0
+      if (conversion_morse_sym && structure_matrice_a_jour(la_matrice)
+          && remplir_coefficients(ref_cast(Matrice_Morse_Sym, la_matrice.valeur())))
+        {
+          /////////////////////////////////////////////////////////
+          // La structure de la Matrice_Morse_Sym retournee a deja
+          // ete calculee lors d'un precedent assemblage: on remplit
+          // seulement ses coefficients depuis la matrice de travail
+          // (sinon, ou si un coefficient elimine par compacte() est
+          // devenu non negligeable, on reconstruit la matrice)
+          /////////////////////////////////////////////////////////
+          meme_stencil = true;
+        }
+      else if (conversion_morse_sym)
         {
           //////////////////////////////////////////////////////////
           // La matrice retournee est une Matrice_Morse_Sym nettoyee
@@ -361,9 +381,11 @@ int Assembleur_P_VEFPreP1B::assembler_mat(Matrice& la_matrice,const DoubleVect&
             ref_cast(Matrice_Morse_Sym, la_matrice.valeur()));
           ref_cast(Matrice_Morse_Sym, la_matrice.valeur()).compacte(
             2);// Suppression des coefficients nuls et quasi non nuls
+          construire_table_remplissage(ref_cast(Matrice_Morse_Sym, la_matrice.valeur()));
         }
       else
         {
+          id_matrice_remplie_ = -1;
           /////////////////////////////////////////////////////////
           // La matrice retournee est une Matrice_Bloc_Sym nettoyee
           /////////////////////////////////////////////////////////
@@ -387,6 +409,8 @@ int Assembleur_P_VEFPreP1B::assembler_mat(Matrice& la_matrice,const DoubleVect&
       SolveurPP1B& solveur_pression_PP1B = ref_cast(SolveurPP1B, solveur_pression.valeur());
       solveur_pression_PP1B.associer(*this, solveur_pression_lu);
     }
+  // On previent le solveur si la structure de la matrice est inchangee (il peut alors reutiliser sa phase symbolique)
+  solveur_pression.valeur().set_same_stencil(meme_stencil);
 
   //////////////////////////////////////////////////////
   // Affichage eventuel du conditionnement de la matrice
@@ -398,6 +422,157 @@ int Assembleur_P_VEFPreP1B::assembler_mat(Matrice& la_matrice,const DoubleVect&
   return 1;
 }
 
+// Liste des sous-blocs Matrice_Morse (RR, RV, VR, VV) de la matrice de travail Matrice_Bloc_Sym avec le decalage
+// de leurs lignes et colonnes dans la numerotation de la Matrice_Morse_Sym construite par BlocSymToMatMorseSym
+static void sous_blocs_morse(const Matrice_Bloc_Sym& matrice, std::vector<const Matrice_Morse*>& sous_blocs,
+                             std::vector<int>& debut_lignes, std::vector<int>& debut_colonnes)
+{
+  sous_blocs.clear();
+  debut_lignes.clear();
+  debut_colonnes.clear();
+  const int nombre_supports = matrice.nb_bloc_lignes();
+  std::vector<int> debut_support(nombre_supports, 0);
+  for (int i = 1; i < nombre_supports; i++)
+    debut_support[i] = debut_support[i - 1] + matrice.get_bloc(i - 1, i - 1).valeur().nb_lignes();
+
+  for (int i = 0; i < nombre_supports; i++)
+    for (int j = i; j < nombre_supports; j++)
+      {
+        const Matrice_Bloc& bloc_ij = ref_cast(Matrice_Bloc, matrice.get_bloc(i, j).valeur());
+        int ideb = debut_support[i];
+        for (int k = 0; k < bloc_ij.nb_bloc_lignes(); k++)
+          {
+            int jdeb = debut_support[j];
+            for (int l = 0; l < bloc_ij.nb_bloc_colonnes(); l++)
+              {
+                const Matrice_Morse& sous_bloc = ref_cast(Matrice_Morse, bloc_ij.get_bloc(k, l).valeur());
+                sous_blocs.push_back(&sous_bloc);
+                debut_lignes.push_back(ideb);
+                debut_colonnes.push_back(jdeb);
+                jdeb += sous_bloc.nb_colonnes();
+              }
+            ideb += bloc_ij.get_bloc(k, 0).valeur().nb_lignes();
+          }
+      }
+}
+
+bool Assembleur_P_VEFPreP1B::structure_matrice_a_jour(const Matrice& la_matrice) const
+{
+  if (version_remplie_ != version_structure_ || has_P_ref_rempli_ != has_P_ref) return false;
+  // L'identifiant d'objet est unique (jamais reutilise), contrairement a l'adresse de la matrice
+  return la_matrice.non_nul() && la_matrice->get_object_id() == id_matrice_remplie_;
+}
+
+/*! @brief Calcule une fois pour toutes, pour chaque coefficient des sous-blocs de la matrice de travail,
+ * son rang dans le tableau coeff_ de la Matrice_Morse_Sym retournee (apres changement de base et compactage).
+ *
+ * Les coefficients de la partie triangulaire inferieure ont un rang -1. Les coefficients elimines par compacte()
+ *  (nuls ou quasi nuls lors de cet assemblage) ont un rang -2-d : leur valeur est cumulee dans coeff_elimine_[d]
+ *  a chaque remplissage pour detecter ceux qui deviendraient non negligeables.
+ */
+void Assembleur_P_VEFPreP1B::construire_table_remplissage(const Matrice_Morse_Sym& matrice)
+{
+  std::vector<const Matrice_Morse*> sous_blocs;
+  std::vector<int> debut_lignes, debut_colonnes;
+  sous_blocs_morse(ref_cast(Matrice_Bloc_Sym, la_matrice_de_travail_.valeur()), sous_blocs, debut_lignes, debut_colonnes);
+
+  const ArrOfInt& tab1 = matrice.get_tab1();
+  const ArrOfInt& tab2 = matrice.get_tab2();
+  const int nb_lignes = matrice.nb_lignes();
+  const int nb_sous_blocs = (int)sous_blocs.size();
+  std::map<std::pair<int, int>, int> coeff_elimines; // (ligne, colonne) -> d
+  ligne_coeff_elimine_.resize_array(0);
+  index_remplissage_.dimensionner_force(nb_sous_blocs);
+  for (int n = 0; n < nb_sous_blocs; n++)
+    {
+      const Matrice_Morse& sous_bloc = *sous_blocs[n];
+      const ArrOfInt& tab1_bloc = sous_bloc.get_tab1();
+      const ArrOfInt& tab2_bloc = sous_bloc.get_tab2();
+      ArrOfInt& index = index_remplissage_[n];
+      index.resize_array(sous_bloc.nb_coeff());
+      index = -1;
+      for (int i = 0; i < sous_bloc.nb_lignes(); i++)
+        {
+          const int ligne = debut_lignes[n] + i;
+          if (ligne >= nb_lignes) break;
+          for (int k = tab1_bloc[i] - 1; k < tab1_bloc[i + 1] - 1; k++)
+            {
+              const int colonne = debut_colonnes[n] + tab2_bloc[k] - 1;
+              if (colonne < ligne) continue; // Seule la partie triangulaire superieure est stockee
+              for (int kk = tab1[ligne] - 1; kk < tab1[ligne + 1] - 1; kk++)
+                if (tab2[kk] - 1 == colonne)
+                  {
+                    index[k] = kk;
+                    break;
+                  }
+              if (index[k] < 0)
+                {
+                  auto it = coeff_elimines.emplace(std::make_pair(ligne, colonne), (int)coeff_elimines.size()).first;
+                  if (it->second == ligne_coeff_elimine_.size_array()) ligne_coeff_elimine_.append_array(ligne);
+                  index[k] = -2 - it->second;
+                }
+            }
+        }
+    }
+  coeff_elimine_.resize_array(ligne_coeff_elimine_.size_array());
+  version_remplie_ = version_structure_;
+  has_P_ref_rempli_ = has_P_ref;
+  id_matrice_remplie_ = matrice.get_object_id();
+}
+
+/*! @brief Remplit en place les coefficients de la Matrice_Morse_Sym a partir de la matrice de travail
+ * a l'aide de la table construite par construire_table_remplissage(). Aucune recherche ni allocation.
+ *
+ * @return false si un coefficient elimine par compacte() lors de la construction n'est plus negligeable
+ *  au sens de compacte(2) : la matrice doit alors etre reconstruite.
+ */
+bool Assembleur_P_VEFPreP1B::remplir_coefficients(Matrice_Morse_Sym& matrice) const
+{
+  std::vector<const Matrice_Morse*> sous_blocs;
+  std::vector<int> debut_lignes, debut_colonnes;
+  sous_blocs_morse(ref_cast(Matrice_Bloc_Sym, la_matrice_de_travail_.valeur()), sous_blocs, debut_lignes, debut_colonnes);
+  assert((int)sous_blocs.size() == index_remplissage_.size());
+
+  matrice.get_set_coeff() = 0.;
+  coeff_elimine_ = 0.;
+  DoubleArrView coeff_v = matrice.get_set_coeff().view_rw();
+  DoubleArrView coeff_elimine_v = coeff_elimine_.view_rw();
+  start_gpu_timer();
+  for (int n = 0; n < (int)sous_blocs.size(); n++)
+    {
+      const int nb_coeff = sous_blocs[n]->nb_coeff();
+      assert(nb_coeff == index_remplissage_[n].size_array());
+      if (nb_coeff == 0) continue;
+      CIntArrView index_v = index_remplissage_[n].view_ro();
+      CDoubleArrView coeff_bloc_v = sous_blocs[n]->get_coeff().view_ro();
+      Kokkos::parallel_for("[KOKKOS] Assembleur_P_VEFPreP1B::remplir_coefficients", nb_coeff, KOKKOS_LAMBDA(const int k)
+      {
+        const int kk = index_v(k);
+        if (kk >= 0) Kokkos::atomic_add(&coeff_v(kk), coeff_bloc_v(k));
+        else if (kk < -1) Kokkos::atomic_add(&coeff_elimine_v(-2 - kk), coeff_bloc_v(k));
+      });
+    }
+  end_gpu_timer(Objet_U::computeOnDevice, "[KOKKOS] Assembleur_P_VEFPreP1B::remplir_coefficients");
+
+  // Memes criteres que Matrice_Morse::compacte(2) : un coefficient non nul n'est elimine que s'il est quasi nul
+  // devant le plus grand coefficient de sa ligne, et jamais sur une ligne dont ce maximum atteint 1e10
+  const ArrOfInt& tab1 = matrice.get_tab1();
+  const DoubleVect& coeff = matrice.get_coeff();
+  int nb_non_negligeables = 0;
+  for (int d = 0; d < coeff_elimine_.size_array(); d++)
+    if (coeff_elimine_[d] != 0)
+      {
+        const int ligne = ligne_coeff_elimine_[d];
+        double coeff_max = std::fabs(coeff_elimine_[d]);
+        for (int k = tab1[ligne] - 1; k < tab1[ligne + 1] - 1; k++)
+          coeff_max = std::max(coeff_max, std::fabs(coeff[k]));
+        if (coeff_max >= 1e10 || !est_egal(std::fabs(coeff_elimine_[d]) / coeff_max, 0))
+          nb_non_negligeables++;
+      }
+  // La decision doit etre la meme sur tous les processeurs (la reconstruction contient des operations collectives)
+  return mp_max(nb_non_negligeables) == 0;
+}
+
 int Assembleur_P_VEFPreP1B::modifier_secmem(DoubleTab& b)
 {
   const Domaine_VEF& le_dom = domaine_Vef();
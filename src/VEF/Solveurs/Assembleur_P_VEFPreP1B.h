@@ -17,8 +17,10 @@
 #define Assembleur_P_VEFPreP1B_included
 
 #include <Assembleur_P_VEF.h>
+#include <TRUSTArrays.h>
 #include <Matrice.h>
 class Domaine_VEF;
+class Matrice_Morse_Sym;
 class Champ_P1_isoP1Bulle;
 enum class vecteur { second_membre , pression_inverse , pression };
 
@@ -73,6 +75,23 @@ protected:
   REF(Equation_base) mon_equation;
   void projete_L2(DoubleTab&);
   double alpha=0., beta=0.; // Coefficients du changement de base P0+P1<->P1Bulle
+
+  // Reassemblage incremental de la matrice Matrice_Morse_Sym retournee par assembler_mat:
+  // sa structure est calculee une seule fois, ensuite seuls ses coefficients sont remplis depuis la_matrice_de_travail_
+  bool structure_matrice_a_jour(const Matrice&) const;
+  void construire_table_remplissage(const Matrice_Morse_Sym&);
+  bool remplir_coefficients(Matrice_Morse_Sym&) const;
+  ArrsOfInt index_remplissage_;         // Pour chaque sous-bloc Morse de la_matrice_de_travail_, rang de chaque coefficient dans la matrice retournee (-1 si ignore, -2-d si elimine par compacte())
+  ArrOfInt ligne_coeff_elimine_;        // Ligne de chaque coefficient d elimine par compacte()
+  mutable ArrOfDouble coeff_elimine_;   // Valeur courante de chaque coefficient d elimine par compacte()
+  int version_structure_ = 0;           // Incremente a chaque changement de structure de la matrice (maillage, conditions limites)
+  int version_remplie_ = -1;            // version_structure_ pour laquelle index_remplissage_ a ete construit
+  int id_matrice_remplie_ = -1;         // Identifiant unique (get_object_id) de la matrice correspondant a index_remplissage_
+  int has_P_ref_rempli_ = -1;           // has_P_ref lors de la construction de index_remplissage_
+
+public :
+  // A appeler si le maillage ou les conditions limites changent : la structure de la matrice sera recalculee
+  inline void invalider_structure_matrice() { version_structure_++; }
 };
 
 #endif
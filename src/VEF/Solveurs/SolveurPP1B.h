@@ -34,6 +34,12 @@ public :
     solveur_pression_.valeur().reinit();
   }
 
+  inline void set_same_stencil(bool flag) override
+  {
+    SolveurSys_base::set_same_stencil(flag);
+    solveur_pression_.valeur().set_same_stencil(flag);
+  }
+
   int associer(const Assembleur_P_VEFPreP1B&, const SolveurSys&);
   inline int solveur_direct() const override { return solveur_pression_.valeur().solveur_direct(); }
   inline void fixer_schema_temps_limpr(int l) override { solveur_pression_.valeur().fixer_schema_temps_limpr(l); }